@@ -137,29 +137,19 @@ static void bitcoin_block_pull_dynafed_details(const u8 **cursor, size_t *len, s
 
 /* Encoding is <blockhdr> <varint-num-txs> <tx>... */
 struct bitcoin_block *
-bitcoin_block_from_hex(const tal_t *ctx, const struct chainparams *chainparams,
-		       const char *hex, size_t hexlen)
+bitcoin_block_from_bytes(const tal_t *ctx,
+			 const struct chainparams *chainparams,
+			 const u8 *p, size_t len)
 {
 	struct bitcoin_block *b;
-	u8 *linear_tx;
-	const u8 *p;
-	size_t len, i, num, templen;
+	size_t i, num, templen;
 	struct sha256_ctx shactx;
 	bool is_dynafed;
 	u32 height;
 
-	if (hexlen && hex[hexlen-1] == '\n')
-		hexlen--;
-
 	/* Set up the block for success. */
 	b = tal(ctx, struct bitcoin_block);
 
-	/* De-hex the array. */
-	len = hex_data_size(hexlen);
-	p = linear_tx = tal_arr(ctx, u8, len);
-	if (!hex_decode(hex, hexlen, linear_tx, len))
-		return tal_free(b);
-
 	sha256_init(&shactx);
 
 	b->hdr.version = pull_le32(&p, &len);
@@ -219,6 +209,29 @@ bitcoin_block_from_hex(const tal_t *ctx, const struct chainparams *chainparams,
 	if (!p || len)
 		return tal_free(b);
 
+	return b;
+}
+
+struct bitcoin_block *
+bitcoin_block_from_hex(const tal_t *ctx, const struct chainparams *chainparams,
+		       const char *hex, size_t hexlen)
+{
+	struct bitcoin_block *b;
+	u8 *linear_tx;
+	size_t len;
+
+	if (hexlen && hex[hexlen-1] == '\n')
+		hexlen--;
+
+	/* De-hex the array. */
+	len = hex_data_size(hexlen);
+	linear_tx = tal_arr(NULL, u8, len);
+	if (!hex_decode(hex, hexlen, linear_tx, len)) {
+		tal_free(linear_tx);
+		return NULL;
+	}
+
+	b = bitcoin_block_from_bytes(ctx, chainparams, linear_tx, len);
 	tal_free(linear_tx);
 	return b;
 }
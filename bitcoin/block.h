@@ -41,6 +41,12 @@ struct bitcoin_block *
 bitcoin_block_from_hex(const tal_t *ctx, const struct chainparams *chainparams,
 		       const char *hex, size_t hexlen);
 
+/* As above, but from the raw serialization */
+struct bitcoin_block *
+bitcoin_block_from_bytes(const tal_t *ctx,
+			 const struct chainparams *chainparams,
+			 const u8 *p, size_t len);
+
 /* Compute the double SHA block ID from the block header. */
 void bitcoin_block_blkid(const struct bitcoin_block *block,
 			 struct bitcoin_blkid *out);
@@ -25,6 +25,7 @@
 #include <common/billboard.h>
 #include <common/ecdh_hsmd.h>
 #include <common/gossip_store.h>
+#include <common/hmac.h>
 #include <common/hsm_capable.h>
 #include <common/hsm_version.h>
 #include <common/interactivetx.h>
@@ -1476,6 +1477,60 @@ static u8 *make_revocation_msg(const struct peer *peer, u64 revoke_index,
 				     point);
 }
 
+/* Apply tweak to ephemeral key if blinding is non-NULL, then do ECDH */
+static bool ecdh_maybe_blinding(const struct pubkey *ephemeral_key,
+				const struct pubkey *blinding,
+				struct secret *ss)
+{
+	struct pubkey point = *ephemeral_key;
+
+	if (blinding) {
+		struct secret hmac;
+		struct secret blinding_ss;
+
+		ecdh(blinding, &blinding_ss);
+		/* b(i) = HMAC256("blinded_node_id", ss(i)) * k(i) */
+		subkey_from_hmac("blinded_node_id", &blinding_ss, &hmac);
+
+		/* We instead tweak the *ephemeral* key from the onion and use
+		 * our normal privkey: since hsmd knows only how to ECDH with
+		 * our real key */
+		if (secp256k1_ec_pubkey_tweak_mul(secp256k1_ctx,
+						  &point.pubkey,
+						  hmac.data) != 1) {
+			return false;
+		}
+	}
+	ecdh(&point, ss);
+	return true;
+}
+
+/* We do the ECDH for their HTLC's onion here, rather than making lightningd
+ * do it (synchronously with hsmd!) for every channel.  NULL if the onion
+ * has no valid ephemeral key: lightningd will fail it. */
+static struct secret *htlc_shared_secret(const tal_t *ctx,
+					 const struct htlc *htlc)
+{
+	const u8 *cursor = htlc->routing;
+	size_t max = TOTAL_PACKET_SIZE(ROUTING_INFO_SIZE);
+	struct pubkey ephemeral_key;
+	struct secret *ss;
+
+	/* We only need the version and ephemeral key, which come first. */
+	if (fromwire_u8(&cursor, &max) != 0)
+		return NULL;
+	fromwire_pubkey(&cursor, &max, &ephemeral_key);
+	if (!cursor)
+		return NULL;
+
+	ss = tal(ctx, struct secret);
+	if (!ecdh_maybe_blinding(&ephemeral_key, htlc->blinding, ss)) {
+		status_debug("htlc %"PRIu64": can't tweak pubkey", htlc->id);
+		return tal_free(ss);
+	}
+	return ss;
+}
+
 /* Convert changed htlcs into parts which lightningd expects. */
 static void marshall_htlc_info(const tal_t *ctx,
 			       const struct htlc **changed_htlcs,
@@ -1502,6 +1557,7 @@ static void marshall_htlc_info(const tal_t *ctx,
 			       htlc->routing,
 			       sizeof(a.onion_routing_packet));
 			a.blinding = htlc->blinding;
+			a.shared_secret = htlc_shared_secret(*added, htlc);
 			a.fail_immediate = htlc->fail_immediate;
 			tal_arr_expand(added, a);
 		} else if (htlc->state == RCVD_REMOVE_COMMIT) {
@@ -2261,7 +2317,10 @@ static void handle_peer_fulfill_htlc(struct peer *peer, const u8 *msg)
 	e = channel_fulfill_htlc(peer->channel, LOCAL, id, &preimage, &h);
 	switch (e) {
 	case CHANNEL_ERR_REMOVE_OK:
-		/* FIXME: We could send preimages to master immediately. */
+		/* Master can pass this upstream before it's committed. */
+		wire_sync_write(MASTER_FD,
+				take(towire_channeld_got_htlc_preimage(NULL, id,
+								       &preimage)));
 		start_commit_timer(peer);
 		return;
 	/* These shouldn't happen, because any offered HTLC (which would give
@@ -5767,6 +5826,7 @@ static void req_in(struct peer *peer, const u8 *msg)
 	case WIRE_CHANNELD_SENDING_COMMITSIG_REPLY:
 	case WIRE_CHANNELD_GOT_COMMITSIG_REPLY:
 	case WIRE_CHANNELD_GOT_REVOKE_REPLY:
+	case WIRE_CHANNELD_GOT_HTLC_PREIMAGE:
 	case WIRE_CHANNELD_GOT_CHANNEL_READY:
 	case WIRE_CHANNELD_GOT_SPLICE_LOCKED:
 	case WIRE_CHANNELD_GOT_ANNOUNCEMENT:
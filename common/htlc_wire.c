@@ -85,6 +85,11 @@ void towire_added_htlc(u8 **pptr, const struct added_htlc *added)
 	} else
 		towire_bool(pptr, false);
 	towire_bool(pptr, added->fail_immediate);
+	if (added->shared_secret) {
+		towire_bool(pptr, true);
+		towire_secret(pptr, added->shared_secret);
+	} else
+		towire_bool(pptr, false);
 }
 
 void towire_existing_htlc(u8 **pptr, const struct existing_htlc *existing)
@@ -186,6 +191,11 @@ void fromwire_added_htlc(const u8 **cursor, size_t *max,
 	} else
 		added->blinding = NULL;
 	added->fail_immediate = fromwire_bool(cursor, max);
+	if (fromwire_bool(cursor, max)) {
+		added->shared_secret = tal(added, struct secret);
+		fromwire_secret(cursor, max, added->shared_secret);
+	} else
+		added->shared_secret = NULL;
 }
 
 struct existing_htlc *fromwire_existing_htlc(const tal_t *ctx,
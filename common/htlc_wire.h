@@ -17,6 +17,8 @@ struct added_htlc {
 	u8 onion_routing_packet[TOTAL_PACKET_SIZE(ROUTING_INFO_SIZE)];
 	bool fail_immediate;
 	struct pubkey *blinding;
+	/* NULL if onion's ephemeral key was invalid (or failed tweak) */
+	struct secret *shared_secret;
 };
 
 /* This is how lightningd tells us about HTLCs which already exist at startup */
@@ -514,7 +514,11 @@ again:
 
 	switch (ret) {
 	case JSMN_ERROR_INVAL:
-		return false;
+		/* jsmn keeps going after the root element: whatever follows
+		 * it (eg. a raw attachment) is not ours to judge. */
+		if ((*toks)[0].type == JSMN_UNDEFINED || (*toks)[0].end == -1)
+			return false;
+		break;
 	case JSMN_ERROR_NOMEM:
 		tal_resize(toks, tal_count(*toks) * 2);
 		goto again;
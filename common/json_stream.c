@@ -7,12 +7,11 @@
 #include <bitcoin/signature.h>
 #include <bitcoin/tx.h>
 #include <ccan/io/io.h>
-  /* To reach into io_plan: not a public header! */
-  #include <ccan/io/backend.h>
 #include <ccan/json_escape/json_escape.h>
 #include <ccan/json_out/json_out.h>
 #include <ccan/str/hex/hex.h>
 #include <ccan/strmap/strmap.h>
+#include <ccan/tal/link/link.h>
 #include <ccan/tal/str/str.h>
 #include <common/channel_id.h>
 #include <common/configdir.h>
@@ -25,15 +24,10 @@
 #include <stdio.h>
 #include <wire/peer_wire.h>
 
-static void adjust_io_write(struct json_out *jout,
-			    ptrdiff_t delta,
-			    struct json_stream *js)
-{
-	/* If io_write is in progress, we shift it to point to new buffer pos */
-	if (js->reader)
-	/* FIXME: This, or something prettier (io_replan?) belong in ccan/io! */
-		js->reader->plan[IO_OUT].arg.u1.cp += delta;
-}
+/* Once this much is in jout, we cut it off into a chunk for the reader */
+#define JSON_STREAM_CHUNK 65536
+/* More than this waiting to be written, and producers should wait */
+#define JSON_STREAM_MAX_QUEUED (16 * JSON_STREAM_CHUNK)
 
 struct json_stream *new_json_stream(const tal_t *ctx,
 				    struct command *writer,
@@ -43,14 +37,92 @@ struct json_stream *new_json_stream(const tal_t *ctx,
 
 	/* FIXME: Add magic so tal_resize can fail! */
 	js->jout = json_out_new(js);
-	json_out_call_on_move(js->jout, adjust_io_write, js);
 	js->writer = writer;
 	js->reader = NULL;
+	js->reader_cb = NULL;
+	js->chunks = tal_arr(js, char *, 0);
+	js->chunks_len = 0;
+	js->drained_cb = NULL;
 	js->log = log;
 	js->filter = NULL;
 	return js;
 }
 
+/* Move everything in jout onto the end of the chunks.  Chunks are never
+ * altered once cut, so they're linkable: json_stream_dup() shares them. */
+static void json_stream_cut_chunk(struct json_stream *js)
+{
+	const char *p;
+	size_t len;
+	char *chunk;
+
+	p = json_out_contents(js->jout, &len);
+	if (!len)
+		return;
+
+	chunk = tal_linkable(tal_dup_arr(NULL, char, p, len, 0));
+	tal_arr_expand(&js->chunks, tal_link(js->chunks, chunk));
+	js->chunks_len += len;
+	json_out_consume(js->jout, len);
+}
+
+/* Called as each element is completed: so jout never grows much past
+ * JSON_STREAM_CHUNK, instead of being reallocated (and copied) as it grows
+ * to hold the entire response. */
+static void json_stream_maybe_cut_chunk(struct json_stream *js)
+{
+	size_t len;
+
+	/* Until we're being output, the contents stay in jout: some callers
+	 * (e.g. plugins) read it directly. */
+	if (!js->reader_cb)
+		return;
+
+	json_out_contents(js->jout, &len);
+	if (len >= JSON_STREAM_CHUNK)
+		json_stream_cut_chunk(js);
+}
+
+bool json_stream_backed_up(const struct json_stream *js)
+{
+	size_t len;
+
+	/* Nobody reading?  Then waiting won't help! */
+	if (!js->reader_cb)
+		return false;
+
+	json_out_contents(js->jout, &len);
+	return js->chunks_len + len > JSON_STREAM_MAX_QUEUED;
+}
+
+static void json_stream_check_drained(struct json_stream *js)
+{
+	void (*cb)(void *arg) = js->drained_cb;
+
+	if (!cb || json_stream_backed_up(js))
+		return;
+
+	js->drained_cb = NULL;
+	cb(js->drained_arg);
+}
+
+void json_stream_when_drained_(struct json_stream *js,
+			       void (*cb)(void *arg),
+			       void *arg)
+{
+	assert(!js->drained_cb);
+	js->drained_cb = cb;
+	js->drained_arg = arg;
+	json_stream_check_drained(js);
+}
+
+void json_stream_output_abandoned(struct json_stream *js)
+{
+	js->reader = NULL;
+	js->reader_cb = NULL;
+	json_stream_check_drained(js);
+}
+
 void json_stream_attach_filter(struct json_stream *js,
 			       struct json_filter *filter STEALS)
 {
@@ -70,13 +142,26 @@ const char *json_stream_detach_filter(const tal_t *ctx, struct json_stream *js)
 	return err;
 }
 
+bool json_stream_wants(const struct json_stream *js, const char *fieldname)
+{
+	return json_filter_ok(js->filter, fieldname);
+}
+
 struct json_stream *json_stream_dup(const tal_t *ctx,
 				    struct json_stream *original,
 				    struct logger *log)
 {
-	struct json_stream *js = tal_dup(ctx, struct json_stream, original);
+	struct json_stream *js;
 
-	js->jout = json_out_dup(js, original->jout);
+	/* Put everything into chunks, so we can share rather than copy
+	 * (before we copy chunks_len!) */
+	json_stream_cut_chunk(original);
+	js = tal_dup(ctx, struct json_stream, original);
+	js->jout = json_out_new(js);
+	js->chunks = tal_arr(js, char *, tal_count(original->chunks));
+	for (size_t i = 0; i < tal_count(js->chunks); i++)
+		js->chunks[i] = tal_link(js->chunks, original->chunks[i]);
+	js->drained_cb = NULL;
 	js->log = log;
 	/* You can't dup things with filters! */
 	assert(!js->filter);
@@ -105,20 +190,38 @@ void json_stream_append(struct json_stream *js,
 	memcpy(dest, str, len);
 }
 
+/* The n'th last character written to the stream (jout, or chunks if
+ * it's been cut already) */
+static char json_stream_last_char(const struct json_stream *js, size_t n)
+{
+	const char *contents;
+	size_t len;
+
+	contents = json_out_contents(js->jout, &len);
+	if (n < len)
+		return contents[len - 1 - n];
+	n -= len;
+
+	for (size_t i = tal_count(js->chunks); i > 0; i--) {
+		len = tal_count(js->chunks[i-1]);
+		if (n < len)
+			return js->chunks[i-1][len - 1 - n];
+		n -= len;
+	}
+	/* It's an object (with an id!): definitely can't be less that "{}" */
+	abort();
+}
+
 /* We promise it will end in '\n\n' */
 void json_stream_double_cr(struct json_stream *js)
 {
-	const char *contents;
-	size_t len, cr_needed;
+	size_t cr_needed;
 
 	/* Must be well-formed at this point! */
 	json_out_finished(js->jout);
 
-	contents = json_out_contents(js->jout, &len);
-	/* It's an object (with an id!): definitely can't be less that "{}" */
-	assert(len >= 2);
-	if (contents[len-1] == '\n') {
-		if (contents[len-2] == '\n')
+	if (json_stream_last_char(js, 0) == '\n') {
+		if (json_stream_last_char(js, 1) == '\n')
 			return;
 		cr_needed = 1;
 	} else
@@ -154,8 +257,10 @@ void json_array_start(struct json_stream *js, const char *fieldname)
 
 void json_array_end(struct json_stream *js)
 {
-	if (json_filter_up(&js->filter))
+	if (json_filter_up(&js->filter)) {
 		json_out_end(js->jout, ']');
+		json_stream_maybe_cut_chunk(js);
+	}
 }
 
 void json_object_start(struct json_stream *js, const char *fieldname)
@@ -166,8 +271,10 @@ void json_object_start(struct json_stream *js, const char *fieldname)
 
 void json_object_end(struct json_stream *js)
 {
-	if (json_filter_up(&js->filter))
+	if (json_filter_up(&js->filter)) {
 		json_out_end(js->jout, '}');
+		json_stream_maybe_cut_chunk(js);
+	}
 }
 
 void json_add_primitive_fmt(struct json_stream *js,
@@ -243,16 +350,21 @@ void json_add_jsonstr(struct json_stream *js,
 static struct io_plan *json_stream_output_write(struct io_conn *conn,
 						struct json_stream *js)
 {
-	const char *p;
-
-	/* For when we've just done some output */
-	json_out_consume(js->jout, js->len_read);
+	/* For when we've just written out a chunk */
+	if (js->len_read) {
+		tal_delink(js->chunks, js->chunks[0]);
+		tal_arr_remove(&js->chunks, 0);
+		js->chunks_len -= js->len_read;
+		js->len_read = 0;
+		json_stream_check_drained(js);
+	}
 
-	/* Get how much we can write out from js */
-	p = json_out_contents(js->jout, &js->len_read);
+	/* Whatever's accumulated in jout is next. */
+	if (tal_count(js->chunks) == 0)
+		json_stream_cut_chunk(js);
 
 	/* Nothing in buffer? */
-	if (!p) {
+	if (tal_count(js->chunks) == 0) {
 		/* We're not doing io_write now, unset. */
 		js->reader = NULL;
 		if (!json_stream_still_writing(js))
@@ -261,8 +373,9 @@ static struct io_plan *json_stream_output_write(struct io_conn *conn,
 	}
 
 	js->reader = conn;
+	js->len_read = tal_count(js->chunks[0]);
 	return io_write(conn,
-			p, js->len_read,
+			js->chunks[0], js->len_read,
 			json_stream_output_write, js);
 }
 
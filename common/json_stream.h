@@ -44,12 +44,22 @@ struct json_stream {
 
 	/* Who is io_writing from this buffer now: NULL if nobody is. */
 	struct io_conn *reader;
+	/* NULL until json_stream_output() (or if reader went away) */
 	struct io_plan *(*reader_cb)(struct io_conn *conn,
 				     struct json_stream *js,
 				     void *arg);
 	void *reader_arg;
 	size_t len_read;
 
+	/* Once we're being output, jout is cut into chunks as it fills:
+	 * the reader writes these out, oldest first. */
+	char **chunks;
+	size_t chunks_len;
+
+	/* Called once the reader has caught up (see json_stream_backed_up) */
+	void (*drained_cb)(void *arg);
+	void *drained_arg;
+
 	/* If non-NULL, reflects the current filter position */
 	struct json_filter *filter;
 
@@ -75,6 +85,9 @@ struct json_stream *new_json_stream(const tal_t *ctx, struct command *writer,
  * stream. For example this is used when construcing a single
  * notification and then duplicating it for the fanout.
  *
+ * The contents so far are shared (refcounted) between @original and the
+ * copy, rather than copied.
+ *
  * @ctx: tal context for allocation.
  * @original: the stream to duplicate.
  * @log: log for new stream.
@@ -91,6 +104,10 @@ void json_stream_attach_filter(struct json_stream *js,
 /* Detach the filter: returns non-NULL string if it was misused. */
 const char *json_stream_detach_filter(const tal_t *ctx, struct json_stream *js);
 
+/* Will @fieldname (a member of the current object) survive the filter?
+ * Use this to skip computing fields which would be filtered out anyway. */
+bool json_stream_wants(const struct json_stream *js, const char *fieldname);
+
 /**
  * json_stream_close - finished writing to a JSON stream.
  * @js: the json_stream.
@@ -197,10 +214,45 @@ struct io_plan *json_stream_output_(struct json_stream *js,
 							  void *arg),
 				    void *arg);
 
+/**
+ * json_stream_output_abandoned - the conn given to json_stream_output is gone.
+ * @js: the json_stream
+ *
+ * Nothing will read from @js any more, so it's never backed up, and
+ * anyone waiting for it to drain is called now.
+ */
+void json_stream_output_abandoned(struct json_stream *js);
+
 /* Ensure there's a double \n after a JSON response. */
 void json_stream_double_cr(struct json_stream *js);
 void json_stream_flush(struct json_stream *js);
 
+/**
+ * json_stream_backed_up - is there too much output waiting to be written?
+ * @js: the json_stream
+ *
+ * Producers of very large responses should check this between batches,
+ * and use json_stream_when_drained() rather than buffering more.
+ */
+bool json_stream_backed_up(const struct json_stream *js);
+
+/**
+ * json_stream_when_drained - call @cb once @js is no longer backed up.
+ * @js: the json_stream
+ * @cb: the callback (called from the writing io_conn's callback!)
+ * @arg: the argument to @cb
+ *
+ * Only one callback can be pending at a time.  It's called immediately
+ * if @js isn't backed up.
+ */
+#define json_stream_when_drained(js, cb, arg)				\
+	json_stream_when_drained_((js),					\
+				  typesafe_cb(void, void *, (cb), (arg)), \
+				  (arg))
+void json_stream_when_drained_(struct json_stream *js,
+			       void (*cb)(void *arg),
+			       void *arg);
+
 /* '"fieldname" : "value"' or '"value"' if fieldname is NULL.  Turns
  * any non-printable chars into JSON escapes, but leaves existing escapes alone.
  */
@@ -190,6 +190,15 @@ static void test_json_tok_size(void)
 	ok = json_parse_input(&parser, &toks, buf, strlen(buf), &complete);
 	assert(!ok);
 
+	/* Raw bytes after the root (eg. an attachment) don't matter */
+	buf = "{\"attachment_length\": 4}\x04\x00\x00\x20";
+	toks_reset(toks);
+	jsmn_init(&parser);
+	ok = json_parse_input(&parser, &toks, buf, strlen(buf) + 3, &complete);
+	assert(ok);
+	assert(complete);
+	assert(toks[0].end == strlen("{\"attachment_length\": 4}"));
+
 	/* This should *not* parse! (used to give toks[0]->size == 2!) */
 	buf = "{ 'satoshi', '546' }";
 	toks = json_parse_simple(tmpctx, buf, strlen(buf));
@@ -222,6 +231,27 @@ static void test_json_bad_utf8(void)
 	buf[toks[7].start] = 't';
 
 	assert(json_parse_simple(tmpctx, buf, strlen(buf)));
+
+	/* Long strings are checked a word at a time: make sure we catch bad
+	 * bytes (and accept good multibyte chars) at every offset. */
+	buf = tal_strdup(tmpctx, "[\"abcdefghijklmnopqrstuvwxyz0123456789\"]");
+	toks = json_parse_simple(tmpctx, buf, strlen(buf));
+	assert(toks);
+	for (int i = toks[1].start; i < toks[1].end; i++) {
+		char c = buf[i];
+		buf[i] = 0xC0;
+		assert(!json_parse_simple(tmpctx, buf, strlen(buf)));
+		buf[i] = c;
+	}
+	for (int i = toks[1].start; i < toks[1].end - 1; i++) {
+		char c1 = buf[i], c2 = buf[i+1];
+		/* U+00E9 */
+		buf[i] = 0xC3;
+		buf[i+1] = 0xA9;
+		assert(json_parse_simple(tmpctx, buf, strlen(buf)));
+		buf[i] = c1;
+		buf[i+1] = c2;
+	}
 }
 
 int main(int argc, char *argv[])
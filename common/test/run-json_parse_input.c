@@ -0,0 +1,124 @@
+#include "config.h"
+#include <assert.h>
+#include <ccan/tal/str/str.h>
+#include <common/json_parse_simple.c>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* AUTOGENERATED MOCKS END */
+
+/* This is mostly a benchmark of json_parse_input on the kind of traffic
+ * lightningd and plugins exchange, fed in read()-sized pieces the way
+ * they get it.  Run with a chunk size (0 meaning "all at once") to time
+ * just that, e.g. `time common/test/run-json_parse_input 4096`. */
+
+/* Like a listpeerchannels response on a node with many channels. */
+static const char *big_response(const tal_t *ctx, size_t num_channels)
+{
+	char *json = tal_strdup(ctx, "{\"jsonrpc\":\"2.0\",\"id\":\"pay#5/cln:listpeerchannels#7\",\"result\":{\"channels\":[");
+
+	for (size_t i = 0; i < num_channels; i++) {
+		tal_append_fmt(&json,
+			       "%s{\"peer_id\":\"02%064zx\",\"peer_connected\":true,"
+			       "\"state\":\"CHANNELD_NORMAL\",\"short_channel_id\":\"%zux1x0\","
+			       "\"to_us_msat\":%zu,\"total_msat\":1000000000,"
+			       "\"features\":[\"option_static_remotekey\",\"option_anchors\"],"
+			       "\"alias\":{\"local\":\"%zux2x3\"},\"private\":false,"
+			       "\"opener\":\"local\",\"closer\":null,\"htlcs\":[]}",
+			       i ? "," : "", i, i + 100, i * 1000, i);
+	}
+	tal_append_fmt(&json, "]}}\n\n");
+	return json;
+}
+
+/* Lots of small ones, like notifications and hooks. */
+static const char *small_messages(const tal_t *ctx, size_t num)
+{
+	char *json = tal_strdup(ctx, "");
+
+	for (size_t i = 0; i < num; i++) {
+		if (i % 2)
+			tal_append_fmt(&json,
+				       "{\"jsonrpc\":\"2.0\",\"method\":\"log\",\"params\":"
+				       "{\"level\":\"info\",\"message\":\"caf\xc3\xa9 #%zu \\\"quoted\\\"\"}}\n\n",
+				       i);
+		else
+			tal_append_fmt(&json,
+				       "{\"jsonrpc\":\"2.0\",\"id\":\"cln:htlc_accepted#%zu\",\"method\":\"htlc_accepted\",\"params\":"
+				       "{\"onion\":{\"payload\":\"%0128zx\",\"type\":\"tlv\"},"
+				       "\"htlc\":{\"short_channel_id\":\"1x2x3\",\"id\":%zu,\"amount_msat\":1000,"
+				       "\"cltv_expiry\":500,\"payment_hash\":\"%064zx\"}}}\n\n",
+				       i, i, i, i);
+	}
+	return json;
+}
+
+/* Parse every message in @input, as if it arrived @chunk bytes per read()
+ * (0 means all at once), returning the total number of tokens. */
+static size_t parse_all(const char *input, size_t chunk)
+{
+	size_t len = strlen(input), used = 0, off = 0, total = 0;
+	jsmntok_t *toks = toks_alloc(tmpctx);
+	jsmn_parser parser;
+	bool complete;
+
+	jsmn_init(&parser);
+	for (;;) {
+		if (chunk == 0 || used + chunk > len)
+			used = len;
+		else
+			used += chunk;
+
+		/* Handle every message we have all of. */
+		for (;;) {
+			if (!json_parse_input(&parser, &toks, input + off,
+					      used - off, &complete))
+				abort();
+			if (!complete)
+				break;
+			total += tal_count(toks);
+			off += toks[0].end;
+			/* What the readers do once a message is handled. */
+			jsmn_init(&parser);
+			toks_reset(toks);
+		}
+
+		/* Only whitespace left? */
+		if (used == len)
+			break;
+	}
+	tal_free(toks);
+	return total;
+}
+
+static void run(const char *input, size_t chunk, size_t iterations)
+{
+	for (size_t i = 0; i < iterations; i++)
+		parse_all(input, chunk);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *big, *small;
+	size_t chunks[] = { 0, 1, 7, 64, 4096, 65536 };
+
+	common_setup(argv[0]);
+
+	big = big_response(tmpctx, 1000);
+	small = small_messages(tmpctx, 1000);
+
+	/* However it's split, we must see the same messages. */
+	for (size_t i = 1; i < ARRAY_SIZE(chunks); i++) {
+		assert(parse_all(big, chunks[i]) == parse_all(big, 0));
+		assert(parse_all(small, chunks[i]) == parse_all(small, 0));
+	}
+
+	if (argc > 1) {
+		size_t chunk = atol(argv[1]);
+		run(big, chunk, 100);
+		run(small, chunk, 100);
+	}
+
+	common_shutdown();
+}
@@ -59,6 +59,9 @@ class Method(object):
         self.deprecated = deprecated
         self.before: List[str] = []
         self.after: List[str] = []
+        self.observe = False
+        self.window: Optional[int] = None
+        self.filters: Optional[List[str]] = None
 
 
 class RpcException(Exception):
@@ -139,6 +142,9 @@ class Request(dict):
         self.termination_tb = "".join(traceback.extract_stack().format()[:-1])
 
     def _write_result(self, result: dict) -> None:
+        # Observed hooks come as notifications: nobody wants an answer.
+        if self.id is None and 'method' not in result:
+            return
         self.plugin._write_locked(result)
 
     def _notify(self, method: str, params: JSONType) -> None:
@@ -483,8 +489,20 @@ class Plugin(object):
     def add_hook(self, name: str, func: Callable[..., JSONType],
                  background: bool = False,
                  before: Optional[List[str]] = None,
-                 after: Optional[List[str]] = None) -> None:
+                 after: Optional[List[str]] = None,
+                 observe: bool = False,
+                 window: Optional[int] = None,
+                 filters: Optional[List[str]] = None) -> None:
         """Register a hook that is called synchronously by lightningd on events
+
+        If `observe` is set, lightningd calls the hook concurrently with the
+        other plugins and does not wait for (or act on) its result.
+
+        For `db_write`, `window` lets lightningd send up to that many writes
+        before it waits for their results (use with `background`).
+
+        For `rpc_command`, `filters` is a list of method names (a trailing
+        `*` matches any suffix): the hook is only called for those.
         """
         if name in self.methods:
             raise ValueError(
@@ -511,17 +529,23 @@ class Plugin(object):
         method.after = []
         if after:
             method.after = after
+        method.observe = observe
+        method.window = window
+        method.filters = filters
         self.methods[name] = method
 
     def hook(self, method_name: str,
              before: List[str] = None,
-             after: List[str] = None) -> JsonDecoratorType:
+             after: List[str] = None,
+             observe: bool = False,
+             filters: Optional[List[str]] = None) -> JsonDecoratorType:
         """Decorator to add a plugin hook to the dispatch table.
 
         Internally uses add_hook.
         """
         def decorator(f: Callable[..., JSONType]) -> Callable[..., JSONType]:
-            self.add_hook(method_name, f, background=False, before=before, after=after)
+            self.add_hook(method_name, f, background=False, before=before,
+                          after=after, observe=observe, filters=filters)
             return f
         return decorator
 
@@ -669,6 +693,11 @@ class Plugin(object):
         if request.method in self.subscriptions:
             func = self.subscriptions[request.method]
         # Wildcard 'all' subscriptions using asterisk
+        # Observe-only hooks are sent as notifications too.
+        elif (request.method in self.methods
+              and self.methods[request.method].observe):
+            func = self.methods[request.method].func
+            request.background = self.methods[request.method].background
         elif '*' in self.subscriptions:
             func = self.subscriptions['*']
         else:
@@ -872,9 +901,16 @@ class Plugin(object):
                 continue
 
             if method.mtype == MethodType.HOOK:
-                hooks.append({'name': method.name,
-                              'before': method.before,
-                              'after': method.after})
+                hook = {'name': method.name,
+                        'before': method.before,
+                        'after': method.after}
+                if method.observe:
+                    hook['observe'] = True
+                if method.window is not None:
+                    hook['window'] = method.window
+                if method.filters is not None:
+                    hook['filters'] = method.filters
+                hooks.append(hook)
                 continue
 
             doc = inspect.getdoc(method.func)
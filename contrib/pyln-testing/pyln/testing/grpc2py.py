@@ -986,6 +986,7 @@ def listpeerchannels_channels2py(m):
         "channel_id": hexlify(m.channel_id),  # PrimitiveField in generate_composite
         "close_to": hexlify(m.close_to),  # PrimitiveField in generate_composite
         "close_to_addr": m.close_to_addr,  # PrimitiveField in generate_composite
+        "created_index": m.created_index,  # PrimitiveField in generate_composite
         "direction": m.direction,  # PrimitiveField in generate_composite
         "dust_limit_msat": amount2msat(m.dust_limit_msat),  # PrimitiveField in generate_composite
         "fee_base_msat": amount2msat(m.fee_base_msat),  # PrimitiveField in generate_composite
@@ -1030,6 +1031,7 @@ def listpeerchannels_channels2py(m):
         "their_to_self_delay": m.their_to_self_delay,  # PrimitiveField in generate_composite
         "to_us_msat": amount2msat(m.to_us_msat),  # PrimitiveField in generate_composite
         "total_msat": amount2msat(m.total_msat),  # PrimitiveField in generate_composite
+        "updated_index": m.updated_index,  # PrimitiveField in generate_composite
     })
 
 
@@ -2003,6 +2005,7 @@ def wait_details2py(m):
         "status": str(m.status),  # EnumField in generate_composite
         "bolt11": m.bolt11,  # PrimitiveField in generate_composite
         "bolt12": m.bolt12,  # PrimitiveField in generate_composite
+        "channel_id": hexlify(m.channel_id),  # PrimitiveField in generate_composite
         "description": m.description,  # PrimitiveField in generate_composite
         "groupid": m.groupid,  # PrimitiveField in generate_composite
         "in_channel": m.in_channel,  # PrimitiveField in generate_composite
@@ -2012,6 +2015,9 @@ def wait_details2py(m):
         "out_channel": m.out_channel,  # PrimitiveField in generate_composite
         "partid": m.partid,  # PrimitiveField in generate_composite
         "payment_hash": hexlify(m.payment_hash),  # PrimitiveField in generate_composite
+        "peer_id": hexlify(m.peer_id),  # PrimitiveField in generate_composite
+        "short_channel_id": m.short_channel_id,  # PrimitiveField in generate_composite
+        "state": m.state,  # PrimitiveField in generate_composite
     })
 
 
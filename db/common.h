@@ -4,6 +4,7 @@
 #include <ccan/list/list.h>
 #include <ccan/short_types/short_types.h>
 #include <ccan/strset/strset.h>
+#include <ccan/time/time.h>
 #include <common/autodata.h>
 #include <common/utils.h>
 #include <stdarg.h>
@@ -29,10 +30,16 @@
  */
 #define SQL(x) NAMED_SQL( __FILE__ ":" stringify(__COUNTER__), x)
 
+struct db_stmt;
+
 struct db {
 	char *filename;
 	const char *in_transaction;
 
+	/* db_commit_transaction_deferred() left the underlying transaction
+	 * open: the next db_begin_transaction() joins it. */
+	bool commit_deferred;
+
 	/* DB-specific context */
 	void *conn;
 
@@ -46,7 +53,9 @@ struct db {
 	/* Translated queries for the current database domain + driver */
 	const struct db_query_set *queries;
 
-	const char **changes;
+	/* Writes in the current transaction, for report_changes_fn: NULL if
+	 * nobody wants them. */
+	struct db_change *changes;
 
 	/* List of statements that have been created but not executed yet. */
 	struct list_head pending_statements;
@@ -61,12 +70,50 @@ struct db {
 	u32 data_version;
 
 	void (*report_changes_fn)(struct db *);
+	/* Optional: if this returns false, report_changes_fn has nothing to
+	 * do, so we don't record changes at all. */
+	bool (*changes_wanted_fn)(struct db *);
 
 	/* Set by --developer */
 	bool developer;
 
 	/* Fatal if we try to write to db */
 	bool readonly;
+
+	/* For backends which keep prepared statements around. */
+	size_t stmt_cache_hits, stmt_cache_misses;
+
+	/* NULL unless db_profile_enable() */
+	struct db_profile *profile;
+
+	/* Optional: called (if profiling) for statements slower than
+	 * profile->slow. */
+	void (*slow_query_fn)(struct db *db, const struct db_stmt *stmt);
+};
+
+/* What we know about each query, while profiling. */
+struct db_query_stats {
+	u64 executions;
+	/* Rows returned by db_step() */
+	u64 rows;
+	/* Sum of the sizes of all the bound parameters */
+	u64 bytes_bound;
+	struct timerel total, max;
+};
+
+struct db_profile {
+	/* Indexed like db->queries->query_table */
+	struct db_query_stats *queries;
+
+	/* Statements taking longer than this get reported to slow_query_fn
+	 * (NULL means never). */
+	struct timerel *slow;
+
+	/* From begin to (actual) commit, and the commit itself. */
+	u64 transactions;
+	struct timerel tx_total, tx_max;
+	struct timerel commit_total, commit_max;
+	struct timemono tx_start;
 };
 
 struct db_query {
@@ -106,6 +153,14 @@ struct db_binding {
 	size_t len;
 };
 
+/* A write, recorded for report_changes_fn (or a backend's replica).  We keep
+ * the query and a copy of its bindings, and only turn it into SQL text if
+ * asked (db_changes()). */
+struct db_change {
+	const char *query;
+	struct db_binding *bindings;
+};
+
 struct db_stmt {
 	/* Our entry in the list of pending statements. */
 	struct list_node list;
@@ -137,6 +192,10 @@ struct db_stmt {
 	/* --developer: map as we reference into a SELECT statement
 	 * in query. */
 	struct strset *cols_used;
+
+	/* If profiling: time spent executing and stepping, and rows. */
+	struct timerel elapsed;
+	u64 rows;
 };
 
 struct db_query_set {
@@ -188,6 +247,9 @@ struct db_config {
 
 	bool (*vacuum_fn)(struct db *db);
 
+	/* Optional: make sure any replica has all committed writes. */
+	void (*sync_replica_fn)(struct db *db);
+
 	bool (*rename_column)(struct db *db,
 			      const char *tablename,
 			      const char *from, const char *to);
@@ -14,9 +14,51 @@
 #define INT4OID			23
 #define TEXTOID			25
 
+struct db_postgres {
+	/* The actual db connection. */
+	PGconn *conn;
+	/* For each entry in db->queries->query_table: NULL if we haven't
+	 * prepared it on this connection, otherwise the parameter types we
+	 * prepared it with. */
+	Oid **prepared;
+};
+
+static inline PGconn *conn2pg(void *conn)
+{
+	struct db_postgres *wrapper = (struct db_postgres *) conn;
+	return wrapper->conn;
+}
+
+/* We only keep plain DML prepared: schema changes can invalidate them. */
+static bool is_dml(const char *query)
+{
+	return strstarts(query, "SELECT")
+		|| strstarts(query, "INSERT")
+		|| strstarts(query, "UPDATE")
+		|| strstarts(query, "DELETE");
+}
+
+/* Schema is changing: drop everything we prepared. */
+static void forget_prepared(struct db *db)
+{
+	struct db_postgres *wrapper = (struct db_postgres *) db->conn;
+	bool any = false;
+
+	for (size_t i = 0; i < tal_count(wrapper->prepared); i++) {
+		if (wrapper->prepared[i]) {
+			wrapper->prepared[i] = tal_free(wrapper->prepared[i]);
+			any = true;
+		}
+	}
+	if (any)
+		PQclear(PQexec(wrapper->conn, "DEALLOCATE ALL;"));
+}
+
 static bool db_postgres_setup(struct db *db)
 {
 	size_t prefix_len = strlen("postgres://");
+	struct db_postgres *wrapper;
+	PGconn *conn;
 
 	/* We attempt to parse the connection string without the `postgres://`
 	prefix first, so we can correctly handle the key-value-pair style of
@@ -30,16 +72,22 @@ static bool db_postgres_setup(struct db *db)
 
 	if (info != NULL) {
 		PQconninfoFree(info);
-		db->conn = PQconnectdb(db->filename + prefix_len);
+		conn = PQconnectdb(db->filename + prefix_len);
 	} else {
-		db->conn = PQconnectdb(db->filename);
+		conn = PQconnectdb(db->filename);
 	}
 
-	if (PQstatus(db->conn) != CONNECTION_OK) {
-		db->error = tal_fmt(db, "Could not connect to %s: %s", db->filename, PQerrorMessage(db->conn));
+	if (PQstatus(conn) != CONNECTION_OK) {
+		db->error = tal_fmt(db, "Could not connect to %s: %s", db->filename, PQerrorMessage(conn));
 		db->conn = NULL;
 		return false;
 	}
+
+	wrapper = tal(db, struct db_postgres);
+	wrapper->conn = conn;
+	wrapper->prepared = tal_arrz(wrapper, Oid *,
+				     db->queries->query_table_size);
+	db->conn = wrapper;
 	return true;
 }
 
@@ -47,10 +95,10 @@ static bool db_postgres_begin_tx(struct db *db)
 {
 	assert(db->conn);
 	PGresult *res;
-	res = PQexec(db->conn, "BEGIN;");
+	res = PQexec(conn2pg(db->conn), "BEGIN;");
 	if (PQresultStatus(res) != PGRES_COMMAND_OK) {
 		db->error = tal_fmt(db, "BEGIN command failed: %s",
-				    PQerrorMessage(db->conn));
+				    PQerrorMessage(conn2pg(db->conn)));
 		PQclear(res);
 		return false;
 	}
@@ -62,10 +110,10 @@ static bool db_postgres_commit_tx(struct db *db)
 {
 	assert(db->conn);
 	PGresult *res;
-	res = PQexec(db->conn, "COMMIT;");
+	res = PQexec(conn2pg(db->conn), "COMMIT;");
 	if (PQresultStatus(res) != PGRES_COMMAND_OK) {
 		db->error = tal_fmt(db, "COMMIT command failed: %s",
-				    PQerrorMessage(db->conn));
+				    PQerrorMessage(conn2pg(db->conn)));
 		PQclear(res);
 		return false;
 	}
@@ -73,6 +121,50 @@ static bool db_postgres_commit_tx(struct db *db)
 	return true;
 }
 
+static const char *prepared_name(const struct db_stmt *stmt)
+{
+	return tal_fmt(tmpctx, "q%zi", db_query_table_index(stmt));
+}
+
+/* Make sure this statement is prepared on the server, if possible. */
+static bool db_postgres_use_prepared(struct db_stmt *stmt,
+				     const Oid *paramTypes)
+{
+	struct db_postgres *wrapper = (struct db_postgres *) stmt->db->conn;
+	size_t slots = stmt->query->placeholders;
+	ssize_t idx = db_query_table_index(stmt);
+	PGresult *res;
+
+	if (idx < 0)
+		return false;
+
+	if (!is_dml(stmt->query->query)) {
+		forget_prepared(stmt->db);
+		return false;
+	}
+
+	if (!wrapper->prepared[idx]) {
+		stmt->db->stmt_cache_misses++;
+		res = PQprepare(wrapper->conn, prepared_name(stmt),
+				stmt->query->query, slots, paramTypes);
+		if (PQresultStatus(res) == PGRES_COMMAND_OK)
+			wrapper->prepared[idx] = tal_dup_arr(wrapper, Oid,
+							     paramTypes,
+							     slots, 0);
+		PQclear(res);
+		return wrapper->prepared[idx] != NULL;
+	}
+
+	/* A NULL binding has no type, so it may not match what we prepared
+	 * with: let the server sort it out. */
+	if (!memeq(wrapper->prepared[idx], slots * sizeof(Oid),
+		   paramTypes, slots * sizeof(Oid)))
+		return false;
+
+	stmt->db->stmt_cache_hits++;
+	return true;
+}
+
 static PGresult *db_postgres_do_exec(struct db_stmt *stmt)
 {
 	int slots = stmt->query->placeholders;
@@ -129,7 +221,14 @@ static PGresult *db_postgres_do_exec(struct db_stmt *stmt)
 			break;
 		}
 	}
-	return PQexecParams(stmt->db->conn, stmt->query->query, slots,
+
+	if (db_postgres_use_prepared(stmt, paramTypes))
+		return PQexecPrepared(conn2pg(stmt->db->conn),
+				      prepared_name(stmt), slots,
+				      paramValues, paramLengths, paramFormats,
+				      resultFormat);
+
+	return PQexecParams(conn2pg(stmt->db->conn), stmt->query->query, slots,
 			    paramTypes, paramValues, paramLengths, paramFormats,
 			    resultFormat);
 }
@@ -141,7 +240,7 @@ static bool db_postgres_query(struct db_stmt *stmt)
 	res = PQresultStatus(stmt->inner_stmt);
 
 	if (res != PGRES_EMPTY_QUERY && res != PGRES_TUPLES_OK) {
-		stmt->error = PQerrorMessage(stmt->db->conn);
+		stmt->error = PQerrorMessage(conn2pg(stmt->db->conn));
 		PQclear(stmt->inner_stmt);
 		stmt->inner_stmt = NULL;
 		return false;
@@ -227,14 +326,14 @@ static bool db_postgres_exec(struct db_stmt *stmt)
 	ok = PQresultStatus(stmt->inner_stmt) == PGRES_COMMAND_OK;
 
 	if (!ok)
-		stmt->error = PQerrorMessage(stmt->db->conn);
+		stmt->error = PQerrorMessage(conn2pg(stmt->db->conn));
 
 	return ok;
 }
 
 static u64 db_postgres_last_insert_id(struct db_stmt *stmt)
 {
-	PGresult *res = PQexec(stmt->db->conn, "SELECT lastval()");
+	PGresult *res = PQexec(conn2pg(stmt->db->conn), "SELECT lastval()");
 	int id = atoi(PQgetvalue(res, 0, 0));
 	PQclear(res);
 	return id;
@@ -260,10 +359,10 @@ static bool db_postgres_vacuum(struct db *db)
 	    && streq(getenv("LIGHTNINGD_POSTGRES_NO_VACUUM"), "1"))
 		return true;
 
-	res = PQexec(db->conn, "VACUUM FULL;");
+	res = PQexec(conn2pg(db->conn), "VACUUM FULL;");
 	if (PQresultStatus(res) != PGRES_COMMAND_OK) {
 		db->error = tal_fmt(db, "VACUUM command failed: %s",
-				    PQerrorMessage(db->conn));
+				    PQerrorMessage(conn2pg(db->conn)));
 		PQclear(res);
 		return false;
 	}
@@ -279,6 +378,7 @@ static bool db_postgres_rename_column(struct db *db,
 
 	cmd = tal_fmt(db, "ALTER TABLE %s RENAME %s TO %s;",
 		      tablename, from, to);
+	forget_prepared(db);
 	db_exec_prepared_v2(take(db_prepare_untranslated(db, cmd)));
 	return true;
 }
@@ -297,6 +397,7 @@ static bool db_postgres_delete_columns(struct db *db,
 	}
 	tal_append_fmt(&cmd, ";");
 
+	forget_prepared(db);
 	db_exec_prepared_v2(take(db_prepare_untranslated(db, cmd)));
 	return true;
 }
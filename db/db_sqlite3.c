@@ -9,11 +9,23 @@
 #if HAVE_SQLITE3
   #include <sqlite3.h>
 
+/* How many commits we let the replica fall behind by. */
+#define BACKUP_MAX_LAG 32
+
 struct db_sqlite3 {
 	/* The actual db connection.  */
 	sqlite3 *conn;
 	/* A replica db connection, if requested, or NULL otherwise.  */
 	sqlite3 *backup_conn;
+	/* Writes committed on conn, but not yet on backup_conn, and how
+	 * many transactions they span. */
+	struct db_change *backup_pending;
+	size_t backup_pending_txs;
+	/* Between begin_tx and commit_tx? */
+	bool in_tx;
+	/* Prepared statements for db->queries->query_table, indexed the same
+	 * way.  NULL if not prepared yet, or currently handed out. */
+	sqlite3_stmt **stmt_cache;
 };
 
 /**
@@ -28,6 +40,58 @@ sqlite3 *conn2sql(void *conn)
 	return wrapper->conn;
 }
 
+/* Returns the stmt_cache slot for this query, or NULL if it's not one of
+ * the static queries (e.g. db_prepare_untranslated). */
+static sqlite3_stmt **stmt_cache_slot(const struct db_stmt *stmt)
+{
+	struct db_sqlite3 *wrapper = (struct db_sqlite3 *) stmt->db->conn;
+	ssize_t idx = db_query_table_index(stmt);
+
+	if (idx < 0)
+		return NULL;
+	return &wrapper->stmt_cache[idx];
+}
+
+static void bind_one(sqlite3_stmt *s, int pos, const struct db_binding *b)
+{
+	switch (b->type) {
+	case DB_BINDING_UNINITIALIZED:
+		abort();
+	case DB_BINDING_UINT64:
+		sqlite3_bind_int64(s, pos, b->v.u64);
+		return;
+	case DB_BINDING_INT:
+		sqlite3_bind_int(s, pos, b->v.i);
+		return;
+	case DB_BINDING_BLOB:
+		sqlite3_bind_blob(s, pos, b->v.blob, b->len,
+				  SQLITE_TRANSIENT);
+		return;
+	case DB_BINDING_TEXT:
+		sqlite3_bind_text(s, pos, b->v.text, b->len,
+				  SQLITE_TRANSIENT);
+		return;
+	case DB_BINDING_NULL:
+		sqlite3_bind_null(s, pos);
+		return;
+	}
+	abort();
+}
+
+static void bind_all(struct db_stmt *stmt, sqlite3_stmt *s)
+{
+	for (size_t i=0; i<stmt->query->placeholders; i++) {
+		struct db_binding *b = &stmt->bindings[i];
+
+		if (b->type == DB_BINDING_UNINITIALIZED)
+			db_fatal(stmt->db, "DB binding not initialized: position=%zu, "
+				 "query=\"%s\n",
+				 i, stmt->query->query);
+		/* sqlite3 uses printf-like offsets, we don't... */
+		bind_one(s, i+1, b);
+	}
+}
+
 static void replicate_statement(const struct db *db,
 				struct db_sqlite3 *wrapper,
 				const char *qry)
@@ -50,12 +114,74 @@ static void replicate_statement(const struct db *db,
 			 qry);
 }
 
-static void db_sqlite3_changes_add(struct db_sqlite3 *wrapper,
-				   struct db_stmt *stmt,
-				   const char *qry)
+/* Run a write again, with the same bindings, on the backup. */
+static void replicate_change(const struct db *db,
+			     struct db_sqlite3 *wrapper,
+			     const struct db_change *change)
 {
-	replicate_statement(stmt->db, wrapper, qry);
-	db_changes_add(stmt, qry);
+	sqlite3_stmt *s;
+	int err;
+
+	sqlite3_prepare_v2(wrapper->backup_conn,
+			   change->query, -1, &s, NULL);
+	for (size_t i = 0; i < tal_count(change->bindings); i++)
+		bind_one(s, i+1, &change->bindings[i]);
+	err = sqlite3_step(s);
+	sqlite3_finalize(s);
+
+	if (err != SQLITE_DONE)
+		db_fatal(db, "Failed to replicate query: %s: %s: %s",
+			 sqlite3_errstr(err),
+			 sqlite3_errmsg(wrapper->backup_conn),
+			 change->query);
+}
+
+/*~ We used to run each write on the backup as soon as we'd run it on the
+ * main db, which doubled the cost of every write, and the fsyncs of every
+ * commit.  Now we remember them, and once a number of commits have piled
+ * up (or someone needs the backup to be current) we apply them all in a
+ * single backup transaction. */
+static void replicate_pending(const struct db *db, struct db_sqlite3 *wrapper)
+{
+	if (tal_count(wrapper->backup_pending) == 0)
+		return;
+
+	replicate_statement(db, wrapper, "BEGIN TRANSACTION;");
+	for (size_t i = 0; i < tal_count(wrapper->backup_pending); i++)
+		replicate_change(db, wrapper, &wrapper->backup_pending[i]);
+	replicate_statement(db, wrapper, "COMMIT;");
+
+	tal_free(wrapper->backup_pending);
+	wrapper->backup_pending = tal_arr(wrapper, struct db_change, 0);
+	wrapper->backup_pending_txs = 0;
+}
+
+static void replicate_stmt(struct db_sqlite3 *wrapper, struct db_stmt *stmt)
+{
+	struct db_change change;
+
+	if (!wrapper->backup_conn)
+		return;
+
+	/* Outside a transaction (e.g. PRAGMA foreign_keys, which does
+	 * nothing inside one), this has to happen right now, and in order. */
+	if (!wrapper->in_tx) {
+		replicate_pending(stmt->db, wrapper);
+		change = db_change_from_stmt(tmpctx, stmt);
+		replicate_change(stmt->db, wrapper, &change);
+		return;
+	}
+
+	change = db_change_from_stmt(wrapper->backup_pending, stmt);
+	tal_arr_expand(&wrapper->backup_pending, change);
+}
+
+static void db_sqlite3_sync_replica(struct db *db)
+{
+	struct db_sqlite3 *wrapper = (struct db_sqlite3 *) db->conn;
+
+	if (wrapper->backup_conn)
+		replicate_pending(db, wrapper);
 }
 
 /* Check if both sqlite3 databases have a data_version variable,
@@ -92,22 +218,6 @@ static bool have_same_data_version(sqlite3 *a, sqlite3 *b)
 	return version_a == version_b;
 }
 
-#if !HAVE_SQLITE3_EXPANDED_SQL
-/* Prior to sqlite3 v3.14, we have to use tracing to dump statements */
-struct db_sqlite3_trace {
-	struct db_sqlite3 *wrapper;
-	struct db_stmt *stmt;
-};
-
-static void trace_sqlite3(void *stmtv, const char *stmt)
-{
-	struct db_sqlite3_trace *trace = (struct db_sqlite3_trace *)stmtv;
-	struct db_sqlite3 *wrapper = trace->wrapper;
-	struct db_stmt *s = trace->stmt;
-	db_sqlite3_changes_add(wrapper, s, stmt);
-}
-#endif
-
 static const char *db_sqlite3_fmt_error(struct db_stmt *stmt)
 {
 	return tal_fmt(stmt, "%s: %s: %s", stmt->location, stmt->query->query,
@@ -139,6 +249,11 @@ static bool db_sqlite3_setup(struct db *db)
 	}
 
 	wrapper = tal(db, struct db_sqlite3);
+	wrapper->stmt_cache = tal_arrz(wrapper, sqlite3_stmt *,
+				       db->queries->query_table_size);
+	wrapper->backup_pending = tal_arr(wrapper, struct db_change, 0);
+	wrapper->backup_pending_txs = 0;
+	wrapper->in_tx = false;
 	db->conn = wrapper;
 
 	err = sqlite3_open_v2(filename, &sql, flags, NULL);
@@ -220,42 +335,27 @@ static bool db_sqlite3_setup(struct db *db)
 
 static bool db_sqlite3_query(struct db_stmt *stmt)
 {
-	sqlite3_stmt *s;
+	sqlite3_stmt *s, **slot;
 	sqlite3 *conn = conn2sql(stmt->db->conn);
 	int err;
 
-	err = sqlite3_prepare_v2(conn, stmt->query->query, -1, &s, NULL);
-
-	for (size_t i=0; i<stmt->query->placeholders; i++) {
-		struct db_binding *b = &stmt->bindings[i];
-
-		/* sqlite3 uses printf-like offsets, we don't... */
-		int pos = i+1;
-		switch (b->type) {
-		case DB_BINDING_UNINITIALIZED:
-			db_fatal(stmt->db, "DB binding not initialized: position=%zu, "
-				 "query=\"%s\n",
-				 i, stmt->query->query);
-		case DB_BINDING_UINT64:
-			sqlite3_bind_int64(s, pos, b->v.u64);
-			break;
-		case DB_BINDING_INT:
-			sqlite3_bind_int(s, pos, b->v.i);
-			break;
-		case DB_BINDING_BLOB:
-			sqlite3_bind_blob(s, pos, b->v.blob, b->len,
-					  SQLITE_TRANSIENT);
-			break;
-		case DB_BINDING_TEXT:
-			sqlite3_bind_text(s, pos, b->v.text, b->len,
-					  SQLITE_TRANSIENT);
-			break;
-		case DB_BINDING_NULL:
-			sqlite3_bind_null(s, pos);
-			break;
-		}
+	/* Take it out of the cache while we use it: the same query can be
+	 * in use more than once (e.g. nested loops), and those just get
+	 * prepared freshly. */
+	slot = stmt_cache_slot(stmt);
+	if (slot && *slot) {
+		s = *slot;
+		*slot = NULL;
+		stmt->db->stmt_cache_hits++;
+		err = SQLITE_OK;
+	} else {
+		if (slot)
+			stmt->db->stmt_cache_misses++;
+		err = sqlite3_prepare_v2(conn, stmt->query->query, -1, &s, NULL);
 	}
 
+	bind_all(stmt, s);
+
 	if (err != SQLITE_OK) {
 		tal_free(stmt->error);
 		stmt->error = db_sqlite3_fmt_error(stmt);
@@ -269,49 +369,23 @@ static bool db_sqlite3_query(struct db_stmt *stmt)
 static bool db_sqlite3_exec(struct db_stmt *stmt)
 {
 	int err;
-	bool success;
 	struct db_sqlite3 *wrapper = (struct db_sqlite3 *) stmt->db->conn;
 
-#if !HAVE_SQLITE3_EXPANDED_SQL
-	/* Register the tracing function if we don't have an explicit way of
-	 * expanding the statement. */
-	struct db_sqlite3_trace trace;
-	trace.wrapper = wrapper;
-	trace.stmt = stmt;
-	sqlite3_trace(conn2sql(stmt->db->conn), trace_sqlite3, &trace);
-#endif
-
 	if (!db_sqlite3_query(stmt)) {
 		/* If the prepare step caused an error we hand it up. */
-		success = false;
-		goto done;
+		return false;
 	}
 
 	err = sqlite3_step(stmt->inner_stmt);
 	if (err != SQLITE_DONE) {
 		tal_free(stmt->error);
 		stmt->error = db_sqlite3_fmt_error(stmt);
-		success = false;
-		goto done;
+		return false;
 	}
 
-#if HAVE_SQLITE3_EXPANDED_SQL
-	/* Manually expand and call the callback */
-	char *expanded_sql;
-	expanded_sql = sqlite3_expanded_sql(stmt->inner_stmt);
-	db_sqlite3_changes_add(wrapper, stmt, expanded_sql);
-	sqlite3_free(expanded_sql);
-#endif
-	success = true;
-
-done:
-#if !HAVE_SQLITE3_EXPANDED_SQL
-	/* Unregister the trace callback to avoid it accessing the potentially
-	 * stale pointer to stmt */
-	sqlite3_trace(conn2sql(stmt->db->conn), NULL, NULL);
-#endif
-
-	return success;
+	replicate_stmt(wrapper, stmt);
+	db_changes_add(stmt);
+	return true;
 }
 
 static bool db_sqlite3_step(struct db_stmt *stmt)
@@ -333,7 +407,7 @@ static bool db_sqlite3_begin_tx(struct db *db)
 		db->error = tal_fmt(db, "Failed to begin a transaction: %s", errmsg);
 		return false;
 	}
-	replicate_statement(db, wrapper, "BEGIN TRANSACTION;");
+	wrapper->in_tx = true;
 	return true;
 }
 
@@ -350,7 +424,11 @@ static bool db_sqlite3_commit_tx(struct db *db)
 		db->error = tal_fmt(db, "Failed to commit a transaction: %s", errmsg);
 		return false;
 	}
-	replicate_statement(db, wrapper, "COMMIT;");
+	wrapper->in_tx = false;
+
+	if (wrapper->backup_conn
+	    && ++wrapper->backup_pending_txs >= BACKUP_MAX_LAG)
+		replicate_pending(db, wrapper);
 	return true;
 }
 
@@ -392,7 +470,18 @@ static const unsigned char *db_sqlite3_column_text(struct db_stmt *stmt, int col
 
 static void db_sqlite3_stmt_free(struct db_stmt *stmt)
 {
-	if (stmt->inner_stmt)
+	sqlite3_stmt **slot;
+
+	if (!stmt->inner_stmt)
+		return;
+
+	/* Put it back for next time, unless there's one there already. */
+	slot = stmt->db->conn ? stmt_cache_slot(stmt) : NULL;
+	if (slot && !*slot) {
+		sqlite3_reset(stmt->inner_stmt);
+		sqlite3_clear_bindings(stmt->inner_stmt);
+		*slot = stmt->inner_stmt;
+	} else
 		sqlite3_finalize(stmt->inner_stmt);
 	stmt->inner_stmt = NULL;
 }
@@ -407,8 +496,16 @@ static void db_sqlite3_close(struct db *db)
 {
 	struct db_sqlite3 *wrapper = (struct db_sqlite3 *) db->conn;
 
-	if (wrapper->backup_conn)
+	/* sqlite3_close() fails if there are statements left. */
+	for (size_t i = 0; i < tal_count(wrapper->stmt_cache); i++) {
+		if (wrapper->stmt_cache[i])
+			sqlite3_finalize(wrapper->stmt_cache[i]);
+	}
+
+	if (wrapper->backup_conn) {
+		replicate_pending(db, wrapper);
 		sqlite3_close(wrapper->backup_conn);
+	}
 	sqlite3_close(wrapper->conn);
 
 	db->conn = tal_free(db->conn);
@@ -433,6 +530,7 @@ static bool db_sqlite3_vacuum(struct db *db)
 		db->error = tal_fmt(db, "%s",
 				    sqlite3_errmsg(conn2sql(db->conn)));
 	sqlite3_finalize(stmt);
+	replicate_pending(db, wrapper);
 	replicate_statement(db, wrapper, "VACUUM;");
 
 	return err == SQLITE_DONE;
@@ -688,6 +786,7 @@ struct db_config db_sqlite3_config = {
 	.teardown_fn = &db_sqlite3_close,
 
 	.vacuum_fn = db_sqlite3_vacuum,
+	.sync_replica_fn = db_sqlite3_sync_replica,
 	.rename_column = db_sqlite3_rename_column,
 	.delete_columns = db_sqlite3_delete_columns,
 };
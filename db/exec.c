@@ -39,6 +39,27 @@ int db_get_version(struct db *db)
 	return res;
 }
 
+void db_stmt_cache_stats(const struct db *db, size_t *hits, size_t *misses)
+{
+	*hits = db->stmt_cache_hits;
+	*misses = db->stmt_cache_misses;
+}
+
+void db_profile_enable(struct db *db, bool enable, const struct timerel *slow)
+{
+	db->profile = tal_free(db->profile);
+	if (!enable)
+		return;
+
+	db->profile = talz(db, struct db_profile);
+	db->profile->queries = tal_arrz(db->profile, struct db_query_stats,
+					db->queries->query_table_size);
+	if (slow)
+		db->profile->slow = tal_dup(db->profile, struct timerel, slow);
+	/* We're probably inside a transaction already. */
+	db->profile->tx_start = time_mono();
+}
+
 u32 db_data_version_get(struct db *db)
 {
 	struct db_stmt *stmt;
@@ -126,9 +147,20 @@ void db_begin_transaction_(struct db *db, const char *location)
 	if (db->in_transaction)
 		db_fatal(db, "Already in transaction from %s", db->in_transaction);
 
+	/* Join the transaction whose commit was deferred: we don't reset
+	 * dirty, since it covers the whole group. */
+	if (db->commit_deferred) {
+		db->commit_deferred = false;
+		db->in_transaction = location;
+		return;
+	}
+
 	/* No writes yet. */
 	db->dirty = false;
 
+	if (db->profile)
+		db->profile->tx_start = time_mono();
+
 	db_prepare_for_changes(db);
 	ok = db->config->begin_tx_fn(db);
 	if (!ok)
@@ -147,9 +179,26 @@ void db_set_readonly(struct db *db, bool readonly)
 	db->readonly = readonly;
 }
 
+static void profile_commit(struct db_profile *profile,
+			   struct timemono commit_start)
+{
+	struct timemono now = time_mono();
+	struct timerel commit = timemono_between(now, commit_start);
+	struct timerel tx = timemono_between(now, profile->tx_start);
+
+	profile->transactions++;
+	profile->tx_total = timerel_add(profile->tx_total, tx);
+	if (time_greater(tx, profile->tx_max))
+		profile->tx_max = tx;
+	profile->commit_total = timerel_add(profile->commit_total, commit);
+	if (time_greater(commit, profile->commit_max))
+		profile->commit_max = commit;
+}
+
 void db_commit_transaction(struct db *db)
 {
 	bool ok;
+	struct timemono start = { { 0, 0 } };
 	assert(db->in_transaction);
 	db_assert_no_outstanding_statements(db);
 
@@ -158,11 +207,53 @@ void db_commit_transaction(struct db *db)
 		db_data_version_incr(db);
 
 	db_report_changes(db, NULL, 0);
+	if (db->profile)
+		start = time_mono();
 	ok = db->config->commit_tx_fn(db);
 
 	if (!ok)
 		db_fatal(db, "Failed to commit DB transaction: %s", db->error);
 
+	if (db->profile)
+		profile_commit(db->profile, start);
+
 	db->in_transaction = NULL;
 	db->dirty = false;
 }
+
+void db_commit_transaction_deferred(struct db *db)
+{
+	assert(db->in_transaction);
+
+	/* Read-only transactions gain nothing from waiting. */
+	if (!db->dirty) {
+		db_commit_transaction(db);
+		return;
+	}
+
+	db_assert_no_outstanding_statements(db);
+	db->in_transaction = NULL;
+	db->commit_deferred = true;
+}
+
+bool db_flush_deferred_commit(struct db *db)
+{
+	if (!db->commit_deferred)
+		return false;
+	assert(!db->in_transaction);
+
+	/* Clear first: the db_write hook can re-enter the io_loop, and
+	 * thus us. */
+	db->commit_deferred = false;
+	db->in_transaction = "db_flush_deferred_commit";
+	db_commit_transaction(db);
+	return true;
+}
+
+void db_sync_replica(struct db *db)
+{
+	/* Only committed writes get replicated. */
+	assert(!db->in_transaction);
+	if (db->config->sync_replica_fn)
+		db->config->sync_replica_fn(db);
+}
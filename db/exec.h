@@ -6,6 +6,7 @@
 #include <ccan/take/take.h>
 
 struct db;
+struct timerel;
 
 /**
  * db_set_intvar - Set an integer variable in the database
@@ -26,9 +27,21 @@ s64 db_get_intvar(struct db *db, const char *varname, s64 defval);
 /* Get the current data version (entries). */
 u32 db_data_version_get(struct db *db);
 
+/* How often the backend could reuse an already-prepared statement. */
+void db_stmt_cache_stats(const struct db *db, size_t *hits, size_t *misses);
+
 /* Get the current database version (migrations). */
 int db_get_version(struct db *db);
 
+/**
+ * db_profile_enable - Start (resetting counters) or stop profiling queries.
+ *
+ * While enabled, db->profile counts executions, rows, bound bytes and time
+ * for each query, and times transactions.  If @slow is non-NULL, statements
+ * taking longer are passed to db->slow_query_fn.
+ */
+void db_profile_enable(struct db *db, bool enable, const struct timerel *slow);
+
 /**
  * db_begin_transaction - Begin a transaction
  *
@@ -48,6 +61,35 @@ bool db_in_transaction(struct db *db);
  */
 void db_commit_transaction(struct db *db);
 
+/**
+ * db_commit_transaction_deferred - End a transaction, but group the commit
+ *
+ * Like db_commit_transaction(), except that if anything was written the
+ * underlying database transaction is left open, and any following
+ * db_begin_transaction() joins it.  This lets us amortize the commit (and
+ * the db_write hook) across several units of work.
+ *
+ * The caller must ensure that nothing which relies on those writes being
+ * durable leaves the process before db_flush_deferred_commit()!
+ */
+void db_commit_transaction_deferred(struct db *db);
+
+/**
+ * db_flush_deferred_commit - Commit a transaction left open by
+ * db_commit_transaction_deferred(), if any.
+ *
+ * Returns true if it committed.
+ */
+bool db_flush_deferred_commit(struct db *db);
+
+/**
+ * db_sync_replica - Make sure any replica has every committed write.
+ *
+ * The sqlite3 backend applies commits to a `main:backup` replica in
+ * batches, so it can lag: call this before relying on the replica.
+ */
+void db_sync_replica(struct db *db);
+
 /**
  * db_set_readonly - make writes fatal or allowed.
  */
@@ -3,6 +3,7 @@
 #include <common/utils.h>
 #include <db/common.h>
 #include <db/utils.h>
+#include <inttypes.h>
 
 /* Matches the hash function used in devtools/sql-rewrite.py */
 static u32 hash_djb2(const char *str)
@@ -37,11 +38,76 @@ size_t db_query_colnum(const struct db_stmt *stmt,
 	return stmt->query->colnames[col].val;
 }
 
+/* Only read the clock if we're profiling. */
+static bool profile_start(const struct db *db, struct timemono *start)
+{
+	if (!db->profile)
+		return false;
+	*start = time_mono();
+	return true;
+}
+
+static void profile_stop(struct db_stmt *stmt, struct timemono start)
+{
+	stmt->elapsed = timerel_add(stmt->elapsed, timemono_since(start));
+}
+
+static u64 bytes_bound(const struct db_stmt *stmt)
+{
+	u64 bytes = 0;
+
+	for (size_t i = 0; i < tal_count(stmt->bindings); i++) {
+		switch (stmt->bindings[i].type) {
+		case DB_BINDING_UNINITIALIZED:
+		case DB_BINDING_NULL:
+			continue;
+		case DB_BINDING_BLOB:
+		case DB_BINDING_TEXT:
+			bytes += stmt->bindings[i].len;
+			continue;
+		case DB_BINDING_UINT64:
+			bytes += sizeof(stmt->bindings[i].v.u64);
+			continue;
+		case DB_BINDING_INT:
+			bytes += sizeof(stmt->bindings[i].v.i);
+			continue;
+		}
+		abort();
+	}
+	return bytes;
+}
+
+static void profile_stmt(struct db_stmt *stmt)
+{
+	struct db_profile *profile = stmt->db->profile;
+	struct db_query_stats *stats;
+	ssize_t idx = db_query_table_index(stmt);
+
+	/* We don't track untranslated queries */
+	if (idx < 0)
+		return;
+
+	stats = &profile->queries[idx];
+	stats->executions++;
+	stats->rows += stmt->rows;
+	stats->bytes_bound += bytes_bound(stmt);
+	stats->total = timerel_add(stats->total, stmt->elapsed);
+	if (time_greater(stmt->elapsed, stats->max))
+		stats->max = stmt->elapsed;
+
+	if (stmt->db->slow_query_fn
+	    && profile->slow
+	    && time_greater(stmt->elapsed, *profile->slow))
+		stmt->db->slow_query_fn(stmt->db, stmt);
+}
+
 static void db_stmt_free(struct db_stmt *stmt)
 {
 	if (!stmt->executed)
 		db_fatal(stmt->db, "Freeing an un-executed statement from %s: %s",
 			 stmt->location, stmt->query->query);
+	if (stmt->db->profile)
+		profile_stmt(stmt);
 	/* If they never got a db_step, we don't track */
 	if (stmt->db->developer && stmt->cols_used) {
 		for (size_t i = 0; i < stmt->query->num_colnames; i++) {
@@ -81,6 +147,8 @@ static struct db_stmt *db_prepare_core(struct db *db,
 	stmt->inner_stmt = NULL;
 	stmt->cols_used = NULL;
 	stmt->bind_pos = -1;
+	stmt->elapsed = time_from_sec(0);
+	stmt->rows = 0;
 
 	tal_add_destructor(stmt, db_stmt_free);
 	list_add(&db->pending_statements, &stmt->list);
@@ -138,9 +206,13 @@ bool db_query_prepared_canfail(struct db_stmt *stmt)
 {
 	/* Make sure we don't accidentally execute a modifying query using a
 	 * read-only path. */
-	bool ret;
+	bool ret, profiling;
+	struct timemono start;
 	assert(stmt->query->readonly);
+	profiling = profile_start(stmt->db, &start);
 	ret = stmt->db->config->query_fn(stmt);
+	if (profiling)
+		profile_stop(stmt, start);
 	stmt->executed = true;
 	list_del_from(&stmt->db->pending_statements, &stmt->list);
 	return ret;
@@ -155,10 +227,16 @@ void db_query_prepared(struct db_stmt *stmt)
 
 bool db_step(struct db_stmt *stmt)
 {
-	bool ret;
+	bool ret, profiling;
+	struct timemono start;
 
 	assert(stmt->executed);
+	profiling = profile_start(stmt->db, &start);
 	ret = stmt->db->config->step_fn(stmt);
+	if (profiling) {
+		profile_stop(stmt, start);
+		stmt->rows += ret;
+	}
 
 	/* We only track cols_used if we return a result! */
 	if (stmt->db->developer && ret && !stmt->cols_used) {
@@ -171,8 +249,13 @@ bool db_step(struct db_stmt *stmt)
 
 void db_exec_prepared_v2(struct db_stmt *stmt TAKES)
 {
+	struct timemono start;
+	bool profiling = profile_start(stmt->db, &start);
 	bool ret = stmt->db->config->exec_fn(stmt);
 
+	if (profiling)
+		profile_stop(stmt, start);
+
 	if (stmt->db->readonly)
 		assert(stmt->query->readonly);
 
@@ -200,9 +283,79 @@ size_t db_count_changes(struct db_stmt *stmt)
 	return stmt->db->config->count_changes_fn(stmt);
 }
 
+/* Same format as sqlite3_expanded_sql(), which is what we used to use. */
+static char *db_change_expand(const tal_t *ctx, const struct db_change *change)
+{
+	char *sql = tal_strdup(ctx, "");
+	const char *p = change->query;
+	size_t n = 0;
+	bool quoted = false;
+
+	for (; *p; p++) {
+		const struct db_binding *b;
+
+		if (*p == '\'')
+			quoted = !quoted;
+		if (*p != '?' || quoted) {
+			tal_append_fmt(&sql, "%c", *p);
+			continue;
+		}
+
+		assert(n < tal_count(change->bindings));
+		b = &change->bindings[n++];
+		switch (b->type) {
+		case DB_BINDING_UNINITIALIZED:
+			abort();
+		case DB_BINDING_NULL:
+			tal_append_fmt(&sql, "NULL");
+			break;
+		case DB_BINDING_UINT64:
+			tal_append_fmt(&sql, "%"PRId64, (s64)b->v.u64);
+			break;
+		case DB_BINDING_INT:
+			tal_append_fmt(&sql, "%i", b->v.i);
+			break;
+		case DB_BINDING_BLOB:
+			tal_append_fmt(&sql, "x'%s'",
+				       tal_hexstr(tmpctx, b->v.blob, b->len));
+			break;
+		case DB_BINDING_TEXT:
+			tal_append_fmt(&sql, "'");
+			for (size_t i = 0; i < b->len; i++) {
+				if (b->v.text[i] == '\'')
+					tal_append_fmt(&sql, "''");
+				else
+					tal_append_fmt(&sql, "%c", b->v.text[i]);
+			}
+			tal_append_fmt(&sql, "'");
+			break;
+		}
+	}
+	return sql;
+}
+
 const char **db_changes(struct db *db)
 {
-	return db->changes;
+	const char **changes;
+
+	if (!db->changes)
+		return NULL;
+
+	/* Owned by db->changes, since report_changes_fn can free tmpctx */
+	changes = tal_arr(db->changes, const char *, tal_count(db->changes));
+	for (size_t i = 0; i < tal_count(db->changes); i++)
+		changes[i] = db_change_expand(changes, &db->changes[i]);
+	return changes;
+}
+
+ssize_t db_query_table_index(const struct db_stmt *stmt)
+{
+	const struct db_query_set *queries = stmt->db->queries;
+
+	if (stmt->query < queries->query_table
+	    || stmt->query >= queries->query_table + queries->query_table_size)
+		return -1;
+	return stmt->query - queries->query_table;
 }
 
 u64 db_last_insert_id_v2(struct db_stmt *stmt TAKES)
@@ -221,7 +374,10 @@ u64 db_last_insert_id_v2(struct db_stmt *stmt TAKES)
  * Optionally add "final" at the end (ie. COMMIT). */
 void db_report_changes(struct db *db, const char *final, size_t min)
 {
-	assert(db->changes);
+	/* Nobody wanted them? */
+	if (!db->changes)
+		return;
+
 	assert(tal_count(db->changes) >= min);
 
 	/* Having changes implies that we have a dirty TX. The opposite is
@@ -229,25 +385,47 @@ void db_report_changes(struct db *db, const char *final, size_t min)
 	 * changes yet. */
 	assert(!tal_count(db->changes) || db->dirty);
 
-	if (tal_count(db->changes) > min && db->report_changes_fn)
+	if (tal_count(db->changes) > min)
 		db->report_changes_fn(db);
 	db->changes = tal_free(db->changes);
 }
 
-void db_changes_add(struct db_stmt *stmt, const char * expanded)
+struct db_change db_change_from_stmt(const tal_t *ctx,
+				     const struct db_stmt *stmt)
+{
+	struct db_change change;
+
+	/* Untranslated queries don't live long. */
+	if (db_query_table_index(stmt) < 0)
+		change.query = tal_strdup(ctx, stmt->query->query);
+	else
+		change.query = stmt->query->query;
+
+	/* The bindings point into caller's memory, so copy. */
+	change.bindings = tal_dup_talarr(ctx, struct db_binding,
+					 stmt->bindings);
+	for (size_t i = 0; i < tal_count(change.bindings); i++) {
+		struct db_binding *b = &change.bindings[i];
+		if (b->type == DB_BINDING_BLOB)
+			b->v.blob = tal_dup_arr(change.bindings, u8,
+						b->v.blob, b->len, 0);
+		else if (b->type == DB_BINDING_TEXT)
+			b->v.text = tal_strndup(change.bindings,
+						b->v.text, b->len);
+	}
+	return change;
+}
+
+void db_changes_add(struct db_stmt *stmt)
 {
 	struct db *db = stmt->db;
+	struct db_change change;
 
-	if (stmt->query->readonly) {
-		return;
-	}
-	/* We get a "COMMIT;" after we've sent our changes. */
-	if (!db->changes) {
-		assert(streq(expanded, "COMMIT;"));
+	if (!db->changes || stmt->query->readonly)
 		return;
-	}
 
-	tal_arr_expand(&db->changes, tal_strdup(db->changes, expanded));
+	change = db_change_from_stmt(db->changes, stmt);
+	tal_arr_expand(&db->changes, change);
 }
 
 void db_assert_no_outstanding_statements(struct db *db)
@@ -306,7 +484,12 @@ static struct db_query_set *db_queries_find(const struct db_config *config)
 void db_prepare_for_changes(struct db *db)
 {
 	assert(!db->changes);
-	db->changes = tal_arr(db, const char *, 0);
+
+	/* Don't record anything if nobody is going to look. */
+	if (!db->report_changes_fn
+	    || (db->changes_wanted_fn && !db->changes_wanted_fn(db)))
+		return;
+	db->changes = tal_arr(db, struct db_change, 0);
 }
 
 void db_fatal(const struct db *db, const char *fmt, ...)
@@ -352,7 +535,13 @@ struct db *db_open_(const tal_t *ctx, const char *filename,
 
 	tal_add_destructor(db, destroy_db);
 	db->in_transaction = NULL;
+	db->commit_deferred = false;
+	db->stmt_cache_hits = db->stmt_cache_misses = 0;
+	db->profile = NULL;
+	db->slow_query_fn = NULL;
 	db->changes = NULL;
+	db->report_changes_fn = NULL;
+	db->changes_wanted_fn = NULL;
 
 	/* This must be outside a transaction, so catch it */
 	assert(!db->in_transaction);
@@ -98,18 +98,33 @@ struct db *db_open_(const tal_t *ctx, const char *filename, bool developer,
 /**
  * Report a statement that changes the wallet
  *
- * Allows the DB driver to report an expanded statement during
- * execution. Changes are queued up and reported to the `db_write` plugin hook
- * upon committing.
+ * Allows the DB driver to report a statement after executing it. Changes
+ * are queued up (as the query and its bindings) and reported to the
+ * `db_write` plugin hook upon committing.  Does nothing if nobody wants
+ * changes in this transaction.
  */
-void db_changes_add(struct db_stmt *db_stmt, const char * expanded);
+void db_changes_add(struct db_stmt *db_stmt);
+
+/**
+ * Copy a statement's query and bindings, so it can be replayed later.
+ */
+struct db_change db_change_from_stmt(const tal_t *ctx,
+				     const struct db_stmt *stmt);
+
 void db_assert_no_outstanding_statements(struct db *db);
 
 /**
- * Access pending changes that have been added to the current transaction.
+ * Access pending changes that have been added to the current transaction,
+ * expanded into SQL statements.  NULL if we're not recording changes.
  */
 const char **db_changes(struct db *db);
 
+/**
+ * Index of this statement's query in db->queries->query_table, or -1 if
+ * it's not from there (i.e. db_prepare_untranslated).
+ */
+ssize_t db_query_table_index(const struct db_stmt *stmt);
+
 /**
  * Accessor for internal use.
  *
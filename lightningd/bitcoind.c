@@ -451,6 +451,7 @@ void bitcoind_sendrawtx_(const tal_t *ctx,
  *	"blockhash": "<blkid>",
  *	"block": "rawblock"
  * }
+ * or, if the plugin does attachments, no "block" but the raw block attached.
  */
 
 struct getrawblockbyheight_call {
@@ -470,6 +471,8 @@ getrawblockbyheight_callback(const char *buf, const jsmntok_t *toks,
 	const char *block_str, *err;
 	struct bitcoin_blkid blkid;
 	struct bitcoin_block *blk;
+	const u8 *attachment;
+	size_t attachment_len;
 	trace_span_resume(call);
 	trace_span_end(call);
 
@@ -481,16 +484,30 @@ getrawblockbyheight_callback(const char *buf, const jsmntok_t *toks,
 		goto clean;
 	}
 
-	err = json_scan(tmpctx, buf, toks, "{result:{blockhash:%,block:%}}",
-			JSON_SCAN(json_to_sha256, &blkid.shad.sha),
-			JSON_SCAN_TAL(tmpctx, json_strdup, &block_str));
-	if (err)
-		bitcoin_plugin_error(call->bitcoind, buf, toks,
-				     "getrawblockbyheight",
-				     "bad 'result' field: %s", err);
+	/* The block may come as a raw attachment, rather than as hex */
+	attachment = plugin_response_attachment(buf, toks, &attachment_len);
+	if (attachment) {
+		err = json_scan(tmpctx, buf, toks, "{result:{blockhash:%}}",
+				JSON_SCAN(json_to_sha256, &blkid.shad.sha));
+		if (err)
+			bitcoin_plugin_error(call->bitcoind, buf, toks,
+					     "getrawblockbyheight",
+					     "bad 'result' field: %s", err);
+		blk = bitcoin_block_from_bytes(tmpctx, chainparams,
+					       attachment, attachment_len);
+	} else {
+		err = json_scan(tmpctx, buf, toks,
+				"{result:{blockhash:%,block:%}}",
+				JSON_SCAN(json_to_sha256, &blkid.shad.sha),
+				JSON_SCAN_TAL(tmpctx, json_strdup, &block_str));
+		if (err)
+			bitcoin_plugin_error(call->bitcoind, buf, toks,
+					     "getrawblockbyheight",
+					     "bad 'result' field: %s", err);
 
-	blk = bitcoin_block_from_hex(tmpctx, chainparams, block_str,
-				     strlen(block_str));
+		blk = bitcoin_block_from_hex(tmpctx, chainparams, block_str,
+					     strlen(block_str));
+	}
 	if (!blk)
 		bitcoin_plugin_error(call->bitcoind, buf, toks,
 				     "getrawblockbyheight",
@@ -525,6 +542,8 @@ void bitcoind_getrawblockbyheight_(struct bitcoind *bitcoind,
 				    bitcoind->log,
 				    NULL,  getrawblockbyheight_callback,
 				    call);
+	/* The block itself may follow as an attachment */
+	req->attachment_ok = true;
 	json_add_num(req->stream, "height", height);
 	jsonrpc_request_end(req);
 	bitcoin_plugin_send(bitcoind, req);
@@ -24,6 +24,7 @@
 #include <lightningd/lightningd.h>
 #include <lightningd/log.h>
 #include <lightningd/notification.h>
+#include <lightningd/plugin_hook.h>
 #include <math.h>
 #include <wallet/txfilter.h>
 
@@ -271,6 +272,10 @@ void broadcast_tx_(const tal_t *ctx,
 {
 	struct outgoing_tx *otx = tal(ctx, struct outgoing_tx);
 
+	/* Whatever we're broadcasting (a close, a penalty, a splice...),
+	 * backups must know about it before the world does. */
+	plugin_hook_db_need_sync(topo->ld);
+
 	otx->channel = channel;
 	bitcoin_txid(tx, &otx->txid);
 	otx->tx = clone_bitcoin_tx(otx, tx);
@@ -1,4 +1,5 @@
 #include "config.h"
+#include <ccan/crypto/sha256/sha256.h>
 #include <ccan/tal/str/str.h>
 #include <common/blockheight_states.h>
 #include <common/closing_fee.h>
@@ -14,10 +15,12 @@
 #include <lightningd/connect_control.h>
 #include <lightningd/gossip_control.h>
 #include <lightningd/hsm_control.h>
+#include <lightningd/htlc_end.h>
 #include <lightningd/notification.h>
 #include <lightningd/opening_common.h>
 #include <lightningd/peer_control.h>
 #include <lightningd/subd.h>
+#include <lightningd/wait.h>
 #include <sodium/randombytes.h>
 #include <wallet/txfilter.h>
 #include <wire/peer_wire.h>
@@ -94,8 +97,10 @@ void delete_channel(struct channel *channel STEALS)
 	const u8 *msg;
 
 	struct peer *peer = channel->peer;
-	if (channel->dbid != 0)
+	if (channel->dbid != 0) {
 		wallet_channel_close(channel->peer->ld->wallet, channel->dbid);
+		channel_index_deleted(channel);
+	}
 
 	/* Tell the hsm to forget the channel, needs to be after it's
 	 * been forgotten here */
@@ -310,6 +315,11 @@ struct channel *new_unsaved_channel(struct peer *peer,
 	channel->ignore_fee_limits = ld->config.ignore_fee_limits;
 	channel->last_stable_connection = 0;
 	channel->stable_conn_timer = NULL;
+	memset(&channel->stats_unflushed, 0, sizeof(channel->stats_unflushed));
+	channel->stats_flush_timer = NULL;
+	memset(&channel->stats, 0, sizeof(channel->stats));
+	channel->state_changes = tal_arr(channel, struct state_change_entry, 0);
+	channel->created_index = channel->updated_index = 0;
 
 	/* No shachain yet */
 	channel->their_shachain.id = 0;
@@ -598,6 +608,11 @@ struct channel *new_channel(struct peer *peer, u64 dbid,
 	channel->ignore_fee_limits = ignore_fee_limits;
 	channel->last_stable_connection = last_stable_connection;
 	channel->stable_conn_timer = NULL;
+	memset(&channel->stats_unflushed, 0, sizeof(channel->stats_unflushed));
+	channel->stats_flush_timer = NULL;
+	memset(&channel->stats, 0, sizeof(channel->stats));
+	channel->state_changes = tal_arr(channel, struct state_change_entry, 0);
+	channel->created_index = channel->updated_index = 0;
  	/* Populate channel->channel_gossip */
 	channel_gossip_init(channel, take(peer_update));
 
@@ -822,6 +837,156 @@ void channel_set_last_tx(struct channel *channel,
 	channel->last_tx = tal_steal(channel, tx);
 }
 
+static u64 channel_index_inc(const struct channel *channel,
+			     enum wait_index idx)
+{
+	return wait_index_increment(channel->peer->ld,
+				    WAIT_SUBSYSTEM_CHANNEL, idx,
+				    "peer_id", fmt_node_id(tmpctx, &channel->peer->id),
+				    "channel_id", fmt_channel_id(tmpctx, &channel->cid),
+				    "short_channel_id", channel->scid ? fmt_short_channel_id(tmpctx, *channel->scid) : NULL,
+				    "state", channel_state_name(channel),
+				    NULL);
+}
+
+/* listpeerchannels shows each HTLC and its state, and spendable_msat and
+ * receivable_msat are worked out from those and the feerates. */
+static void hash_htlcs(struct sha256_ctx *sctx, const struct channel *channel)
+{
+	/* FIXME: make per-channel htlc maps! */
+	const struct htlc_in *hin;
+	struct htlc_in_map_iter ini;
+	const struct htlc_out *hout;
+	struct htlc_out_map_iter outi;
+	struct lightningd *ld = channel->peer->ld;
+
+	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
+	     hin;
+	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
+		if (hin->key.channel != channel)
+			continue;
+		sha256_update(sctx, "in", 2);
+		sha256_update(sctx, &hin->key.id, sizeof(hin->key.id));
+		sha256_update(sctx, &hin->hstate, sizeof(hin->hstate));
+	}
+
+	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
+	     hout;
+	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
+		if (hout->key.channel != channel)
+			continue;
+		sha256_update(sctx, "out", 3);
+		sha256_update(sctx, &hout->key.id, sizeof(hout->key.id));
+		sha256_update(sctx, &hout->hstate, sizeof(hout->hstate));
+	}
+
+	if (channel->fee_states) {
+		for (enum side side = 0; side < NUM_SIDES; side++) {
+			u32 feerate = get_feerate(channel->fee_states,
+						  channel->opener, side);
+			sha256_update(sctx, &feerate, sizeof(feerate));
+		}
+	}
+}
+
+/* The fields listpeerchannels shows which change as the channel is used:
+ * most saves (e.g. for each commitment) change none of these. */
+static void channel_listed_hash(const struct channel *channel,
+				struct sha256 *h)
+{
+	struct sha256_ctx sctx = SHA256_INIT;
+	const struct peer_update *remote_update;
+
+#define hash_field(f) sha256_update(&sctx, &(f), sizeof(f))
+	hash_field(channel->state);
+	hash_field(channel->funding);
+	hash_field(channel->funding_sats);
+	hash_field(channel->our_funds);
+	hash_field(channel->our_msat);
+	hash_field(channel->msat_to_us_min);
+	hash_field(channel->msat_to_us_max);
+	hash_field(channel->feerate_base);
+	hash_field(channel->feerate_ppm);
+	hash_field(channel->htlc_minimum_msat);
+	hash_field(channel->htlc_maximum_msat);
+	hash_field(channel->min_possible_feerate);
+	hash_field(channel->max_possible_feerate);
+	hash_field(channel->ignore_fee_limits);
+	hash_field(channel->closer);
+	hash_field(channel->lease_expiry);
+	hash_field(channel->stats);
+	if (channel->scid)
+		hash_field(*channel->scid);
+	if (channel->alias[LOCAL])
+		hash_field(*channel->alias[LOCAL]);
+	if (channel->alias[REMOTE])
+		hash_field(*channel->alias[REMOTE]);
+	remote_update = channel_gossip_get_remote_update(channel);
+	if (remote_update) {
+		hash_field(remote_update->fee_base);
+		hash_field(remote_update->fee_ppm);
+		hash_field(remote_update->cltv_delta);
+		hash_field(remote_update->htlc_minimum_msat);
+		hash_field(remote_update->htlc_maximum_msat);
+	}
+#undef hash_field
+	for (enum side side = 0; side < NUM_SIDES; side++) {
+		if (channel->shutdown_scriptpubkey[side])
+			sha256_update(&sctx, channel->shutdown_scriptpubkey[side],
+				      tal_bytelen(channel->shutdown_scriptpubkey[side]));
+	}
+	hash_htlcs(&sctx, channel);
+	sha256_done(&sctx, h);
+}
+
+void channel_index_created(struct channel *channel)
+{
+	channel->created_index = channel_index_inc(channel, WAIT_INDEX_CREATED);
+	channel_listed_hash(channel, &channel->listed_hash);
+}
+
+void channel_index_updated(struct channel *channel)
+{
+	channel->updated_index = channel_index_inc(channel, WAIT_INDEX_UPDATED);
+	channel_listed_hash(channel, &channel->listed_hash);
+}
+
+void channel_index_updated_if_changed(struct channel *channel)
+{
+	struct sha256 h;
+
+	channel_listed_hash(channel, &h);
+	if (!sha256_eq(&h, &channel->listed_hash))
+		channel_index_updated(channel);
+}
+
+void channel_index_loaded(struct channel *channel)
+{
+	channel_listed_hash(channel, &channel->listed_hash);
+}
+
+void channel_index_deleted(const struct channel *channel)
+{
+	channel_index_inc(channel, WAIT_INDEX_DELETED);
+}
+
+void channel_add_state_change(struct channel *channel,
+			      struct timeabs timestamp,
+			      enum channel_state old_state,
+			      enum channel_state new_state,
+			      enum state_change cause,
+			      const char *message)
+{
+	struct state_change_entry e;
+
+	e.timestamp = timestamp;
+	e.old_state = old_state;
+	e.new_state = new_state;
+	e.cause = cause;
+	e.message = tal_strdup(channel->state_changes, message);
+	tal_arr_expand(&channel->state_changes, e);
+}
+
 void channel_set_state(struct channel *channel,
 		       enum channel_state old_state,
 		       enum channel_state state,
@@ -865,6 +1030,8 @@ void channel_set_state(struct channel *channel,
 					state,
 					reason,
 					why);
+		channel_add_state_change(channel, timestamp, old_state, state,
+					 reason, why);
 		notify_channel_state_changed(channel->peer->ld,
 					     &channel->peer->id,
 					     &channel->cid,
@@ -314,6 +314,22 @@ struct channel {
 	/* Last time we had a stable connection, if any (0 = none) */
 	u64 last_stable_connection;
 	struct oneshot *stable_conn_timer;
+
+	/* HTLC statistics not yet written to the db: these are added by
+	 * wallet_channel_stats_flush(), on a timer or on wallet_channel_save(). */
+	struct channel_stats stats_unflushed;
+	struct oneshot *stats_flush_timer;
+
+	/* Totals (including unflushed) and state change history, kept
+	 * here so listpeerchannels needn't ask the db. */
+	struct channel_stats stats;
+	struct state_change_entry *state_changes;
+
+	/* Indexes for the "channels" wait subsystem: created_index is 0
+	 * until we're saved, updated_index is 0 until we first change. */
+	u64 created_index, updated_index;
+	/* Hash of what listpeerchannels showed when we last set them */
+	struct sha256 listed_hash;
 };
 
 /* Is channel owned (and should be talking to peer) */
@@ -726,6 +742,26 @@ void channel_set_state(struct channel *channel,
 		       enum state_change reason,
 		       char *why);
 
+/* Increment the "channels" wait indexes (and set created/updated_index) */
+void channel_index_created(struct channel *channel);
+void channel_index_updated(struct channel *channel);
+void channel_index_deleted(const struct channel *channel);
+
+/* Increment updated_index only if a field listpeerchannels shows has
+ * changed since channel_index_loaded/created/updated. */
+void channel_index_updated_if_changed(struct channel *channel);
+
+/* Channel is freshly loaded from the db: nothing has changed yet. */
+void channel_index_loaded(struct channel *channel);
+
+/* Append to the in-memory history (channel_set_state does this for you) */
+void channel_add_state_change(struct channel *channel,
+			      struct timeabs timestamp,
+			      enum channel_state old_state,
+			      enum channel_state new_state,
+			      enum state_change cause,
+			      const char *message);
+
 const char *channel_change_state_reason_str(enum state_change reason);
 
 /* Find a channel which is passes filter, if any: sets *others if there
@@ -27,6 +27,7 @@
 #include <lightningd/peer_control.h>
 #include <lightningd/peer_fd.h>
 #include <lightningd/peer_htlcs.h>
+#include <lightningd/plugin_hook.h>
 #include <wally_bip32.h>
 #include <wally_psbt.h>
 
@@ -906,6 +907,10 @@ static void handle_update_inflight(struct lightningd *ld,
 
 	psbt_finalize(inflight->funding_psbt);
 	wallet_inflight_save(ld->wallet, inflight);
+
+	/* Backups must have the splice commitment before the peer gets
+	 * our signatures for it. */
+	plugin_hook_db_need_sync(ld);
 }
 
 void channel_record_open(struct channel *channel, u32 blockheight, bool record_push)
@@ -1403,6 +1408,9 @@ static unsigned channel_msg(struct subd *sd, const u8 *msg, const int *fds)
 	case WIRE_CHANNELD_GOT_REVOKE:
 		peer_got_revoke(sd->channel, msg);
 		break;
+	case WIRE_CHANNELD_GOT_HTLC_PREIMAGE:
+		peer_got_htlc_preimage(sd->channel, msg);
+		break;
 	case WIRE_CHANNELD_GOT_CHANNEL_READY:
 		peer_got_channel_ready(sd->channel, msg);
 		break;
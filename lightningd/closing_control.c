@@ -35,6 +35,7 @@
 #include <lightningd/options.h>
 #include <lightningd/peer_control.h>
 #include <lightningd/peer_fd.h>
+#include <lightningd/plugin_hook.h>
 #include <lightningd/subd.h>
 #include <openingd/dualopend_wiregen.h>
 #include <wally_bip32.h>
@@ -275,6 +276,9 @@ static void peer_received_closing_signature(struct channel *channel,
 	if (closing_fee_is_acceptable(ld, channel, tx)) {
 		channel_set_last_tx(channel, tx, &sig);
 		wallet_channel_save(ld->wallet, channel);
+		/* Backups must have the close before the peer gets our
+		 * signature. */
+		plugin_hook_db_need_sync(ld);
 	}
 
 
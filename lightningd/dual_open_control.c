@@ -3563,6 +3563,9 @@ static void handle_commit_ready(struct subd *dualopend,
 
 	}
 
+	/* Backups must have the channel before the peer gets our sigs */
+	plugin_hook_db_need_sync(ld);
+
 	/* Send back ack! */
 	subd_send_msg(dualopend,
 		      take(towire_dualopend_commit_send_ack(NULL)));
@@ -3613,6 +3616,9 @@ static void handle_commit_received(struct subd *dualopend,
 					pbase);
 	}
 
+	/* Backups must have their commitment before we sign the funding */
+	plugin_hook_db_need_sync(ld);
+
 	switch (channel->opener) {
 	case LOCAL:
 		if (!channel->open_attempt || !channel->open_attempt->cmd) {
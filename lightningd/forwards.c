@@ -4,6 +4,7 @@
 #include <common/json_command.h>
 #include <common/json_param.h>
 #include <common/json_stream.h>
+#include <common/timeout.h>
 #include <inttypes.h>
 #include <lightningd/forwards.h>
 #include <lightningd/htlc_end.h>
@@ -174,6 +175,68 @@ static void listforwardings_add_forwardings(struct json_stream *response,
 	tal_free(forwardings);
 }
 
+/*~ A node can have millions of forwards: rather than building the whole
+ * listing in one go (stalling everything else while we do), we list them
+ * in rowid order, a batch at a time, going back to the event loop between
+ * batches.  The response streams out as we go. */
+#define LISTFORWARDS_BATCH 1000
+
+struct listforwards_iter {
+	struct command *cmd;
+	struct json_stream *response;
+	enum forward_status status;
+	const struct short_channel_id *chan_in, *chan_out;
+	/* Next rowid, and how many more we're allowed (if limited) */
+	u64 next;
+	u32 *remaining;
+};
+
+/* Returns false if that was the last batch. */
+static bool listforwards_batch(struct listforwards_iter *iter)
+{
+	const struct forwarding *forwardings;
+	const enum wait_index created = WAIT_INDEX_CREATED;
+	u32 limit = LISTFORWARDS_BATCH;
+	size_t num;
+
+	if (iter->remaining && *iter->remaining < limit)
+		limit = *iter->remaining;
+
+	forwardings = wallet_forwarded_payments_get(tmpctx, iter->cmd->ld->wallet,
+						    iter->status,
+						    iter->chan_in, iter->chan_out,
+						    &created, iter->next, &limit);
+	num = tal_count(forwardings);
+	for (size_t i = 0; i < num; i++) {
+		json_object_start(iter->response, NULL);
+		json_add_forwarding_fields(iter->response, &forwardings[i], NULL);
+		json_object_end(iter->response);
+	}
+
+	if (iter->remaining)
+		*iter->remaining -= num;
+	if (num < limit || (iter->remaining && *iter->remaining == 0))
+		return false;
+
+	iter->next = forwardings[num - 1].created_index + 1;
+	return true;
+}
+
+static struct command_result *listforwards_done(struct listforwards_iter *iter)
+{
+	json_array_end(iter->response);
+	return command_success(iter->cmd, iter->response);
+}
+
+static void listforwards_next(struct listforwards_iter *iter)
+{
+	if (listforwards_batch(iter)) {
+		command_next_batch(iter->cmd, listforwards_next, iter);
+		return;
+	}
+	was_pending(listforwards_done(iter));
+}
+
 static struct command_result *param_forward_status(struct command *cmd,
 						   const char *name,
 						   const char *buffer,
@@ -202,6 +265,7 @@ static struct command_result *json_listforwards(struct command *cmd,
 	enum wait_index *listindex;
 	u64 *liststart;
 	u32 *listlimit;
+	struct listforwards_iter *iter;
 
 	if (!param(cmd, buffer, params,
 		   p_opt_def("status", param_forward_status, &status,
@@ -229,9 +293,29 @@ static struct command_result *json_listforwards(struct command *cmd,
 	}
 
 	response = json_stream_success(cmd);
-	listforwardings_add_forwardings(response, cmd->ld->wallet, *status, chan_in, chan_out, listindex, *liststart, listlimit);
 
-	return command_success(cmd, response);
+	/* updated_index isn't unique (it's 0 until updated), so we can't
+	 * page through it: do it all at once. */
+	if (listindex && *listindex == WAIT_INDEX_UPDATED) {
+		listforwardings_add_forwardings(response, cmd->ld->wallet, *status, chan_in, chan_out, listindex, *liststart, listlimit);
+		return command_success(cmd, response);
+	}
+
+	iter = tal(cmd, struct listforwards_iter);
+	iter->cmd = cmd;
+	iter->response = response;
+	iter->status = *status;
+	iter->chan_in = chan_in;
+	iter->chan_out = chan_out;
+	iter->next = *liststart;
+	iter->remaining = listlimit;
+
+	json_array_start(response, "forwards");
+	if (!listforwards_batch(iter))
+		return listforwards_done(iter);
+
+	command_next_batch(cmd, listforwards_next, iter);
+	return command_still_pending(cmd);
 }
 
 static const struct json_command listforwards_command = {
@@ -306,3 +390,83 @@ static const struct json_command delforward_command = {
 	"Delete a forwarded payment by [in_channel], [in_htlc_id] and [status]"
 };
 AUTODATA(json_command, &delforward_command);
+
+/* Like listforwards, we archive a batch at a time so a huge backlog of old
+ * forwards doesn't stall everything else. */
+static u32 archiveforwards_batch(struct command *cmd, u32 max,
+				 struct timeabs *resolved_before)
+{
+	return wallet_forwards_archive(cmd->ld->wallet, *resolved_before, max);
+}
+
+static struct command_result *json_archiveforwards(struct command *cmd,
+						   const char *buffer,
+						   const jsmntok_t *obj UNNEEDED,
+						   const jsmntok_t *params)
+{
+	u64 *age;
+	struct timeabs *resolved_before;
+
+	if (!param(cmd, buffer, params,
+		   p_req("age", param_u64, &age),
+		   NULL))
+		return command_param_failed();
+
+	resolved_before = tal(cmd, struct timeabs);
+	*resolved_before = timeabs_sub(time_now(), time_from_sec(*age));
+	return command_batched(cmd, "archived",
+			       archiveforwards_batch, resolved_before);
+}
+
+static const struct json_command archiveforwards_command = {
+	"archiveforwards",
+	"channels",
+	json_archiveforwards,
+	"Move forwards resolved more than {age} seconds ago out of the live forwards table"
+};
+AUTODATA(json_command, &archiveforwards_command);
+
+struct delforwards_info {
+	enum forward_status status;
+	struct timeabs before;
+};
+
+/* Like archiveforwards, a batch (and db transaction) at a time. */
+static u32 delforwards_batch(struct command *cmd, u32 max,
+			     struct delforwards_info *info)
+{
+	return wallet_forwards_delete_older(cmd->ld->wallet,
+					    info->status, info->before, max);
+}
+
+static struct command_result *json_delforwards(struct command *cmd,
+					       const char *buffer,
+					       const jsmntok_t *obj UNNEEDED,
+					       const jsmntok_t *params)
+{
+	enum forward_status *status;
+	u64 *age;
+	struct delforwards_info *info;
+
+	if (!param_check(cmd, buffer, params,
+			 p_req("status", param_forward_delstatus, &status),
+			 p_req("age", param_u64, &age),
+			 NULL))
+		return command_param_failed();
+
+	if (command_check_only(cmd))
+		return command_check_done(cmd);
+
+	info = tal(cmd, struct delforwards_info);
+	info->status = *status;
+	info->before = timeabs_sub(time_now(), time_from_sec(*age));
+	return command_batched(cmd, "deleted", delforwards_batch, info);
+}
+
+static const struct json_command delforwards_command = {
+	"delforwards",
+	"channels",
+	json_delforwards,
+	"Delete all forwards with {status} older than {age} seconds"
+};
+AUTODATA(json_command, &delforwards_command);
@@ -1298,6 +1298,68 @@ static void json_add_invoices(struct json_stream *response,
 	}
 }
 
+/* Like listforwards, we go back to the event loop after each batch. */
+#define LISTINVOICES_BATCH 1000
+
+struct listinvoices_iter {
+	struct command *cmd;
+	struct json_stream *response;
+	const struct sha256 *local_offer_id;
+	/* Next id, and how many more we're allowed (if limited) */
+	u64 next;
+	u32 *remaining;
+};
+
+/* Returns false if that was the last batch. */
+static bool listinvoices_batch(struct listinvoices_iter *iter)
+{
+	struct invoices *invoices = iter->cmd->ld->wallet->invoices;
+	const enum wait_index created = WAIT_INDEX_CREATED;
+	u32 limit = LISTINVOICES_BATCH, num = 0;
+	struct db_stmt *stmt;
+	u64 inv_dbid;
+
+	if (iter->remaining && *iter->remaining < limit)
+		limit = *iter->remaining;
+
+	for (stmt = invoices_first(invoices, &created, iter->next, &limit,
+				   &inv_dbid);
+	     stmt;
+	     stmt = invoices_next(invoices, stmt, &inv_dbid)) {
+		const struct invoice_details *details;
+
+		num++;
+		iter->next = inv_dbid + 1;
+		details = invoices_get_details(tmpctx, invoices, inv_dbid);
+		if (iter->local_offer_id) {
+			if (!details->local_offer_id
+			    || !sha256_eq(iter->local_offer_id,
+					  details->local_offer_id))
+				continue;
+		}
+		json_add_invoice(iter->response, NULL, details);
+	}
+
+	if (iter->remaining)
+		*iter->remaining -= num;
+	return num == limit && !(iter->remaining && *iter->remaining == 0);
+}
+
+static struct command_result *listinvoices_done(struct listinvoices_iter *iter)
+{
+	json_array_end(iter->response);
+	return command_success(iter->cmd, iter->response);
+}
+
+static void listinvoices_next(struct listinvoices_iter *iter)
+{
+	if (listinvoices_batch(iter)) {
+		command_next_batch(iter->cmd, listinvoices_next, iter);
+		return;
+	}
+	was_pending(listinvoices_done(iter));
+}
+
 static struct command_result *json_listinvoices(struct command *cmd,
 						const char *buffer,
 						const jsmntok_t *obj UNNEEDED,
@@ -1366,6 +1428,23 @@ static struct command_result *json_listinvoices(struct command *cmd,
 
 	response = json_stream_success(cmd);
 	json_array_start(response, "invoices");
+
+	/* A full listing can be huge: do that in batches (but updated_index
+	 * isn't unique, so we can't page through that). */
+	if (!label && !payment_hash
+	    && !(listindex && *listindex == WAIT_INDEX_UPDATED)) {
+		struct listinvoices_iter *iter = tal(cmd, struct listinvoices_iter);
+		iter->cmd = cmd;
+		iter->response = response;
+		iter->local_offer_id = offer_id;
+		iter->next = *liststart;
+		iter->remaining = listlimit;
+		if (!listinvoices_batch(iter))
+			return listinvoices_done(iter);
+		command_next_batch(cmd, listinvoices_next, iter);
+		return command_still_pending(cmd);
+	}
+
 	json_add_invoices(response, wallet, label, payment_hash, offer_id,
 			  listindex, *liststart, listlimit);
 	json_array_end(response);
@@ -1468,6 +1547,72 @@ static const struct json_command delinvoice_command = {
 };
 AUTODATA(json_command, &delinvoice_command);
 
+static struct command_result *param_invoice_delstatus(struct command *cmd,
+						      const char *name,
+						      const char *buffer,
+						      const jsmntok_t *tok,
+						      enum invoice_status **status)
+{
+	*status = tal(cmd, enum invoice_status);
+	if (json_tok_streq(buffer, tok, "paid"))
+		**status = PAID;
+	else if (json_tok_streq(buffer, tok, "expired"))
+		**status = EXPIRED;
+	else
+		return command_fail_badparam(cmd, name, buffer, tok,
+					     "should be 'paid' or 'expired'");
+	return NULL;
+}
+
+struct delinvoices_info {
+	enum invoice_status status;
+	u64 before;
+};
+
+/* A batch (and db transaction) at a time, so we don't stall everything. */
+static u32 delinvoices_batch(struct command *cmd, u32 max,
+			     struct delinvoices_info *info)
+{
+	return invoices_delete_older(cmd->ld->wallet->invoices,
+				     info->status, info->before, max);
+}
+
+static struct command_result *json_delinvoices(struct command *cmd,
+					       const char *buffer,
+					       const jsmntok_t *obj UNNEEDED,
+					       const jsmntok_t *params)
+{
+	enum invoice_status *status;
+	u64 *age;
+	struct delinvoices_info *info;
+
+	if (!param_check(cmd, buffer, params,
+			 p_req("status", param_invoice_delstatus, &status),
+			 p_req("age", param_u64, &age),
+			 NULL))
+		return command_param_failed();
+
+	if (command_check_only(cmd))
+		return command_check_done(cmd);
+
+	info = tal(cmd, struct delinvoices_info);
+	info->status = *status;
+	info->before = time_now().ts.tv_sec;
+	/* Age before epoch?  Then there's nothing that old. */
+	if (*age > info->before)
+		*age = info->before;
+	info->before -= *age;
+	return command_batched(cmd, "deleted", delinvoices_batch, info);
+}
+
+static const struct json_command delinvoices_command = {
+	"delinvoices",
+	"payment",
+	json_delinvoices,
+	"Delete all invoices with {status} paid or expired at least {age} seconds ago",
+};
+AUTODATA(json_command, &delinvoices_command);
+
 static struct command_result *json_waitanyinvoice(struct command *cmd,
 						  const char *buffer,
 						  const jsmntok_t *obj UNNEEDED,
@@ -4,6 +4,49 @@
 #include <db/exec.h>
 #include <lightningd/io_loop_with_timers.h>
 #include <lightningd/lightningd.h>
+#include <lightningd/plugin_hook.h>
+
+/*~ Messages from channel subdaemons only commit their db transaction
+ * lazily (see sd_msg_read()), so all the HTLC updates we process in one
+ * loop iteration share a single commit, and backups may lag behind commits.
+ * Both have to be caught up before we next poll(), as that's when we can
+ * write anything to anyone, but not from inside poll(): the db_write hook
+ * runs a nested io_loop, which can add and remove fds and so change the
+ * very pollfds ccan/io handed us.  So an immediate timer makes io_loop()
+ * return first, and we do it here. */
+static struct oneshot *flush_timer;
+
+static void flush_timer_expired(struct lightningd *ld)
+{
+	/* The flush itself happened before timers were run, below. */
+	flush_timer = NULL;
+}
+
+static void flush_db(struct lightningd *ld)
+{
+	static bool flushing;
+
+	/* Waiting for plugins runs an io_loop, which mustn't flush again.
+	 * Nor can we flush from a loop nested inside a transaction. */
+	if (!ld->wallet || flushing || db_in_transaction(ld->wallet->db))
+		return;
+
+	flushing = true;
+	db_flush_deferred_commit(ld->wallet->db);
+	/* Backups (db_write plugins with a window, or a sqlite3 replica) can
+	 * lag: catch them up if we're about to reveal state they need. */
+	if (plugin_hook_db_flush())
+		db_sync_replica(ld->wallet->db);
+	flushing = false;
+}
+
+void io_loop_flush_before_poll(struct lightningd *ld)
+{
+	/* An expired timer makes io_loop() return before it polls. */
+	if (!flush_timer)
+		flush_timer = new_reltimer(ld->timers, ld, time_from_msec(0),
+					   flush_timer_expired, ld);
+}
 
 void *io_loop_with_timers(struct lightningd *ld)
 {
@@ -21,6 +64,8 @@ void *io_loop_with_timers(struct lightningd *ld)
 		 * (which never happens in our code). */
 		retval = io_loop(ld->timers, &expired);
 
+		flush_db(ld);
+
 		/*~ Notice that timers are called here in the event loop like
 		 * anything else, so there are no weird concurrency issues. */
 		if (expired) {
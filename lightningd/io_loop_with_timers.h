@@ -7,4 +7,8 @@ struct lightningd;
 
 void *io_loop_with_timers(struct lightningd *ld);
 
+/* Make io_loop_with_timers() come back around (committing any deferred db
+ * transaction) before ccan/io next polls. */
+void io_loop_flush_before_poll(struct lightningd *ld);
+
 #endif /* LIGHTNING_LIGHTNINGD_IO_LOOP_WITH_TIMERS_H */
@@ -168,6 +168,10 @@ static void destroy_jcon(struct json_connection *jcon)
 	list_for_each(&jcon->commands, c, list)
 		c->jcon = NULL;
 
+	/* Nobody will read these now: don't let commands wait for them. */
+	for (size_t i = 0; i < tal_count(jcon->js_arr); i++)
+		json_stream_output_abandoned(jcon->js_arr[i]);
+
 	/* Make sure this happens last! */
 	tal_free(jcon->log);
 }
@@ -704,6 +708,107 @@ struct command_result *command_still_pending(struct command *cmd)
 	return &pending;
 }
 
+struct command_batch {
+	struct command *cmd;
+	void (*cb)(void *arg);
+	void *arg;
+};
+
+static void command_batch_next(struct command_batch *batch)
+{
+	void (*cb)(void *arg) = batch->cb;
+	void *arg = batch->arg;
+
+	tal_free(batch);
+	cb(arg);
+}
+
+static void command_batch_drained(struct command_batch *batch)
+{
+	/* We're called from the writer: go back to the event loop first. */
+	new_reltimer(batch->cmd->ld->timers, batch, time_from_msec(0),
+		     command_batch_next, batch);
+}
+
+void command_next_batch_(struct command *cmd,
+			 void (*cb)(void *arg),
+			 void *arg)
+{
+	struct command_batch *batch = tal(cmd, struct command_batch);
+
+	batch->cmd = cmd;
+	batch->cb = cb;
+	batch->arg = arg;
+
+	/* Start writing out what we have so far... */
+	json_stream_flush(cmd->json_stream);
+	/* ... but don't buffer more than we need to. */
+	json_stream_when_drained(cmd->json_stream,
+				 command_batch_drained, batch);
+}
+
+/* Big enough to be efficient, small enough not to stall everything else. */
+#define COMMAND_BATCH_SIZE 1000
+
+struct batched_command {
+	struct command *cmd;
+	const char *fieldname;
+	u32 (*batch)(struct command *cmd, u32 max, void *arg);
+	void *arg;
+	u64 total;
+};
+
+/* Returns false if that was the last batch. */
+static bool batched_command_one(struct batched_command *bc)
+{
+	u32 num = bc->batch(bc->cmd, COMMAND_BATCH_SIZE, bc->arg);
+
+	bc->total += num;
+	return num == COMMAND_BATCH_SIZE;
+}
+
+static struct command_result *batched_command_done(struct batched_command *bc)
+{
+	struct json_stream *response = json_stream_success(bc->cmd);
+
+	json_add_u64(response, bc->fieldname, bc->total);
+	return command_success(bc->cmd, response);
+}
+
+/* Each timer runs in its own db transaction. */
+static void batched_command_next(struct batched_command *bc)
+{
+	if (batched_command_one(bc)) {
+		new_reltimer(bc->cmd->ld->timers, bc, time_from_msec(0),
+			     batched_command_next, bc);
+		return;
+	}
+	was_pending(batched_command_done(bc));
+}
+
+struct command_result *command_batched_(struct command *cmd,
+					const char *fieldname,
+					u32 (*batch)(struct command *cmd,
+						     u32 max,
+						     void *arg),
+					void *arg)
+{
+	struct batched_command *bc = tal(cmd, struct batched_command);
+
+	bc->cmd = cmd;
+	bc->fieldname = fieldname;
+	bc->batch = batch;
+	bc->arg = arg;
+	bc->total = 0;
+
+	if (!batched_command_one(bc))
+		return batched_command_done(bc);
+
+	new_reltimer(cmd->ld->timers, bc, time_from_msec(0),
+		     batched_command_next, bc);
+	return command_still_pending(cmd);
+}
+
 static void json_command_malformed(struct json_connection *jcon,
 				   const char *id,
 				   const char *error)
@@ -1073,11 +1178,17 @@ log_error_and_skip:
 	return true;
 }
 
-REGISTER_PLUGIN_HOOK(rpc_command,
-		     rpc_command_hook_callback,
-		     rpc_command_hook_final,
-		     rpc_command_hook_serialize,
-		     struct rpc_command_hook_payload *);
+static const char *rpc_command_hook_strfilter(struct rpc_command_hook_payload *p)
+{
+	return p->cmd->json_cmd->name;
+}
+
+REGISTER_PLUGIN_HOOK_STRFILTER(rpc_command,
+			       rpc_command_hook_strfilter,
+			       rpc_command_hook_callback,
+			       rpc_command_hook_final,
+			       rpc_command_hook_serialize,
+			       struct rpc_command_hook_payload *);
 
 /* We return struct command_result so command_fail return value has a natural
  * sink; we don't actually use the result. */
@@ -1179,8 +1290,10 @@ parse_request(struct json_connection *jcon, const jsmntok_t tok[])
 
 	rpc_hook = tal(c, struct rpc_command_hook_payload);
 	rpc_hook->cmd = c;
-	/* Duplicate since we might outlive the connection */
-	rpc_hook->buffer = tal_dup_talarr(rpc_hook, char, jcon->buffer);
+	/* Duplicate since we might outlive the connection (just up to the
+	 * end of this request: the buffer may be much larger) */
+	rpc_hook->buffer = tal_dup_arr(rpc_hook, char, jcon->buffer,
+				       tok->end, 0);
 	rpc_hook->request = tal_dup_talarr(rpc_hook, jsmntok_t, tok);
 
 	/* NULL the custom_ values for the hooks */
@@ -1301,7 +1414,7 @@ again:
 
 	/* Remove first {}. */
 	memmove(jcon->buffer, jcon->buffer + jcon->input_toks[0].end,
-		tal_count(jcon->buffer) - jcon->input_toks[0].end);
+		jcon->used - jcon->input_toks[0].end);
 	jcon->used -= jcon->input_toks[0].end;
 
 	/* Reset parser. */
@@ -1609,6 +1722,7 @@ struct jsonrpc_request *jsonrpc_request_start_(
 	static u64 next_request_id = 0;
 
 	r->id_is_string = id_as_string;
+	r->attachment_ok = false;
 	if (r->id_is_string) {
 		if (id_prefix) {
 			/* Strip "" and otherwise sanity-check */
@@ -92,6 +92,8 @@ struct jsonrpc_request {
 	void (*response_cb)(const char *buffer, const jsmntok_t *toks,
 			    const jsmntok_t *idtok, void *);
 	void *response_cb_arg;
+	/* Can the response carry an attachment?  Defaults to false. */
+	bool attachment_ok;
 };
 
 /**
@@ -142,6 +144,30 @@ struct command_result *command_failed(struct command *cmd,
 struct command_result *command_still_pending(struct command *cmd)
 	 WARN_UNUSED_RESULT;
 
+/* For commands which produce a huge response in batches: call @cb from the
+ * event loop once the output so far has been mostly written out. */
+#define command_next_batch(cmd, cb, arg)				\
+	command_next_batch_((cmd), typesafe_cb(void, void *, (cb), (arg)), \
+			    (arg))
+void command_next_batch_(struct command *cmd,
+			 void (*cb)(void *arg),
+			 void *arg);
+
+/* For commands which work through a big backlog in the db: call @batch
+ * (with a maximum to do) a db transaction at a time, until it does fewer
+ * than that, then succeed with { @fieldname: total done }. */
+#define command_batched(cmd, fieldname, batch, arg)			\
+	command_batched_((cmd), (fieldname),				\
+			 typesafe_cb_preargs(u32, void *, (batch), (arg), \
+					     struct command *, u32),	\
+			 (arg))
+struct command_result *command_batched_(struct command *cmd,
+					const char *fieldname,
+					u32 (*batch)(struct command *cmd,
+						     u32 max,
+						     void *arg),
+					void *arg);
+
 /* For low-level JSON stream access: */
 struct json_stream *json_stream_raw_for_cmd(struct command *cmd);
 void json_stream_log_suppress_for_cmd(struct json_stream *js,
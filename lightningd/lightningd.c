@@ -616,6 +616,8 @@ again:
 		/*~ A peer can have multiple channels. */
 		while ((c = list_top(&p->channels, struct channel, list))
 		       != NULL) {
+			/* Don't lose any statistics still in memory. */
+			wallet_channel_stats_flush(ld->wallet, c);
 			/* Removes itself from list as we free it */
 			tal_free(c);
 		}
@@ -1164,7 +1166,7 @@ int main(int argc, char *argv[])
 	int exit_code = 0;
 	char **orig_argv;
 	bool try_reexec;
-	size_t num_channels;
+	size_t num_channels, cache_hits, cache_misses;
 
 	trace_span_start("lightningd/startup", argv);
 
@@ -1519,6 +1521,10 @@ stop:
 	/* Get rid of per-channel subdaemons. */
 	subd_shutdown_nonglobals(ld);
 
+	/* Backup plugins should have every write before they go. */
+	plugin_hook_db_need_sync(ld);
+	plugin_hook_db_flush();
+
 	/* Tell plugins we're shutting down, use force if necessary. */
 	shutdown_plugins(ld);
 
@@ -1532,6 +1538,9 @@ stop:
 	free_all_channels(ld);
 
 	/* Now close database */
+	db_stmt_cache_stats(ld->wallet->db, &cache_hits, &cache_misses);
+	log_debug(ld->log, "DB statement cache: %zu hits, %zu misses",
+		  cache_hits, cache_misses);
 	ld->wallet->db = tal_free(ld->wallet->db);
 
 	remove(ld->pidfile);
@@ -597,6 +597,31 @@ void notify_channel_open_failed(struct lightningd *ld,
 	notify_send(ld, n);
 }
 
+static void db_slow_query_serialize(struct json_stream *stream,
+				    const char *location,
+				    const char *query,
+				    u64 rows,
+				    struct timerel elapsed)
+{
+	json_add_string(stream, "location", location);
+	json_add_string(stream, "query", query);
+	json_add_u64(stream, "rows", rows);
+	json_add_u64(stream, "usec", time_to_usec(elapsed));
+}
+
+REGISTER_NOTIFICATION(db_slow_query);
+
+void notify_db_slow_query(struct lightningd *ld,
+			  const char *location,
+			  const char *query,
+			  u64 rows,
+			  struct timerel elapsed)
+{
+	struct jsonrpc_notification *n = notify_start("db_slow_query");
+	db_slow_query_serialize(n->stream, location, query, rows, elapsed);
+	notify_send(ld, n);
+}
+
 REGISTER_NOTIFICATION(shutdown);
 
 bool notify_plugin_shutdown(struct lightningd *ld, struct plugin *p)
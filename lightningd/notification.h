@@ -99,6 +99,13 @@ void notify_openchannel_peer_sigs(struct lightningd *ld,
 void notify_channel_open_failed(struct lightningd *ld,
                                 const struct channel_id *cid);
 
+/* A database statement took longer than the dbprofile threshold */
+void notify_db_slow_query(struct lightningd *ld,
+			  const char *location,
+			  const char *query,
+			  u64 rows,
+			  struct timerel elapsed);
+
 /* Tell this plugin about deprecated flag for next: returns false
  * if doesn't subscribe */
 bool notify_deprecated_oneshot(struct lightningd *ld,
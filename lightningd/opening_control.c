@@ -453,6 +453,9 @@ static void opening_funder_finished(struct subd *openingd, const u8 *resp,
 	if (pbase)
 		wallet_penalty_base_add(ld->wallet, channel->dbid, pbase);
 
+	/* Backups must have the channel before we can fund it. */
+	plugin_hook_db_need_sync(ld);
+
 	/* If this fails, it cleans up */
 	if (!peer_start_channeld(channel, peer_fd, NULL, false, NULL))
 		return;
@@ -560,6 +563,9 @@ static void opening_fundee_finished(struct subd *openingd,
 	if (pbase)
 		wallet_penalty_base_add(ld->wallet, channel->dbid, pbase);
 
+	/* Backups must have the channel before the peer gets funding_signed */
+	plugin_hook_db_need_sync(ld);
+
 	/* On to normal operation (frees if it fails!) */
 	if (peer_start_channeld(channel, peer_fd, fwd_msg, false, NULL))
 		tal_free(uc);
@@ -1702,6 +1702,67 @@ static struct command_result *param_payment_status(struct command *cmd,
 				     "should be an invoice status");
 }
 
+/* Like listinvoices, we go back to the event loop after each batch. */
+#define LISTSENDPAYS_BATCH 1000
+
+struct listsendpays_iter {
+	struct command *cmd;
+	struct json_stream *response;
+	const enum payment_status *status;
+	/* Next id, and how many more we're allowed (if limited) */
+	u64 next;
+	u32 *remaining;
+};
+
+/* Returns false if that was the last batch. */
+static bool listsendpays_batch(struct listsendpays_iter *iter)
+{
+	struct wallet *wallet = iter->cmd->ld->wallet;
+	const enum wait_index created = WAIT_INDEX_CREATED;
+	u32 limit = LISTSENDPAYS_BATCH, num = 0;
+	struct db_stmt *stmt;
+
+	if (iter->remaining && *iter->remaining < limit)
+		limit = *iter->remaining;
+
+	if (iter->status)
+		stmt = payments_by_status(wallet, *iter->status,
+					  &created, iter->next, &limit);
+	else
+		stmt = payments_first(wallet, &created, iter->next, &limit);
+
+	for (; stmt; stmt = payments_next(wallet, stmt)) {
+		const struct wallet_payment *payment;
+
+		num++;
+		payment = payment_get_details(tmpctx, stmt);
+		iter->next = payment->id + 1;
+		json_object_start(iter->response, NULL);
+		json_add_payment_fields(iter->response, payment);
+		json_object_end(iter->response);
+	}
+
+	if (iter->remaining)
+		*iter->remaining -= num;
+	return num == limit && !(iter->remaining && *iter->remaining == 0);
+}
+
+static struct command_result *listsendpays_done(struct listsendpays_iter *iter)
+{
+	json_array_end(iter->response);
+	return command_success(iter->cmd, iter->response);
+}
+
+static void listsendpays_next(struct listsendpays_iter *iter)
+{
+	if (listsendpays_batch(iter)) {
+		new_reltimer(iter->cmd->ld->timers, iter, time_from_msec(0),
+			     listsendpays_next, iter);
+		return;
+	}
+	was_pending(listsendpays_done(iter));
+}
+
 static struct command_result *json_listsendpays(struct command *cmd,
 						const char *buffer,
 						const jsmntok_t *obj UNNEEDED,
@@ -1775,6 +1836,23 @@ static struct command_result *json_listsendpays(struct command *cmd,
 	response = json_stream_success(cmd);
 
 	json_array_start(response, "payments");
+
+	/* A full listing can be huge: do that in batches (but updated_index
+	 * isn't unique, so we can't page through that). */
+	if (!rhash && !(listindex && *listindex == WAIT_INDEX_UPDATED)) {
+		struct listsendpays_iter *iter = tal(cmd, struct listsendpays_iter);
+		iter->cmd = cmd;
+		iter->response = response;
+		iter->status = status;
+		iter->next = *liststart;
+		iter->remaining = listlimit;
+		if (!listsendpays_batch(iter))
+			return listsendpays_done(iter);
+		new_reltimer(cmd->ld->timers, iter, time_from_msec(0),
+			     listsendpays_next, iter);
+		return command_still_pending(cmd);
+	}
+
 	if (rhash)
 		stmt = payments_by_hash(cmd->ld->wallet, rhash);
 	else if (status)
@@ -1906,6 +1984,55 @@ static const struct json_command delpay_command = {
 };
 AUTODATA(json_command, &delpay_command);
 
+struct delpays_info {
+	enum payment_status status;
+	u64 created_before;
+};
+
+/* A batch (and db transaction) at a time, so we don't stall everything. */
+static u32 delpays_batch(struct command *cmd, u32 max,
+			 struct delpays_info *info)
+{
+	return wallet_payments_delete_older(cmd->ld->wallet, info->status,
+					    info->created_before, max);
+}
+
+static struct command_result *json_delpays(struct command *cmd,
+					   const char *buffer,
+					   const jsmntok_t *obj UNNEEDED,
+					   const jsmntok_t *params)
+{
+	enum payment_status *status;
+	u64 *age;
+	struct delpays_info *info;
+
+	if (!param_check(cmd, buffer, params,
+			 p_req("status", param_payment_status_nopending, &status),
+			 p_req("age", param_u64, &age),
+			 NULL))
+		return command_param_failed();
+
+	if (command_check_only(cmd))
+		return command_check_done(cmd);
+
+	info = tal(cmd, struct delpays_info);
+	info->status = *status;
+	info->created_before = time_now().ts.tv_sec;
+	/* Age before epoch?  Then there's nothing that old. */
+	if (*age > info->created_before)
+		*age = info->created_before;
+	info->created_before -= *age;
+	return command_batched(cmd, "deleted", delpays_batch, info);
+}
+
+static const struct json_command delpays_command = {
+	"delpays",
+	"payment",
+	json_delpays,
+	"Delete all payments with {status} created at least {age} seconds ago",
+};
+AUTODATA(json_command, &delpays_command);
+
 static struct command_result *json_createonion(struct command *cmd,
 						const char *buffer,
 						const jsmntok_t *obj UNNEEDED,
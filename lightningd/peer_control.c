@@ -63,6 +63,7 @@
 #include <lightningd/peer_htlcs.h>
 #include <lightningd/plugin_hook.h>
 #include <lightningd/subd.h>
+#include <lightningd/wait.h>
 #include <limits.h>
 #include <onchaind/onchaind_wiregen.h>
 #include <openingd/dualopend_wiregen.h>
@@ -816,7 +817,7 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 	struct channel_stats channel_stats;
 	struct amount_msat funding_msat;
 	struct amount_sat peer_funded_sats;
-	struct state_change_entry *state_changes;
+	const struct state_change_entry *state_changes;
 	const struct peer_update *peer_update;
 	u32 feerate;
 
@@ -872,11 +873,15 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 	json_add_string(response, "state", channel_state_name(channel));
 	if (channel->last_tx && !invalid_last_tx(channel->last_tx)) {
 		struct bitcoin_txid txid;
-		bitcoin_txid(channel->last_tx, &txid);
 
-		json_add_txid(response, "scratch_txid", &txid);
-		json_add_amount_sat_msat(response, "last_tx_fee_msat",
-					 bitcoin_tx_compute_fee(channel->last_tx));
+		/* Hashing and fee calculation aren't free: skip if unwanted */
+		if (json_stream_wants(response, "scratch_txid")) {
+			bitcoin_txid(channel->last_tx, &txid);
+			json_add_txid(response, "scratch_txid", &txid);
+		}
+		if (json_stream_wants(response, "last_tx_fee_msat"))
+			json_add_amount_sat_msat(response, "last_tx_fee_msat",
+						 bitcoin_tx_compute_fee(channel->last_tx));
 	}
 
 	json_add_bool(response, "lost_state", channel->future_per_commitment_point ? true : false);
@@ -904,6 +909,10 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 
 	json_add_string(response, "channel_id",
 			fmt_channel_id(tmpctx, &channel->cid));
+	if (channel->created_index)
+		json_add_u64(response, "created_index", channel->created_index);
+	if (channel->updated_index)
+		json_add_u64(response, "updated_index", channel->updated_index);
 	json_add_txid(response, "funding_txid", &channel->funding.txid);
 	json_add_num(response, "funding_outnum", channel->funding.n);
 
@@ -960,7 +969,8 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 				     "splice_amount",
 				     inflight->funding->splice_amnt);
 			/* Add the expected commitment tx id also */
-			if (inflight->last_tx) {
+			if (inflight->last_tx
+			    && json_stream_wants(response, "scratch_txid")) {
 				bitcoin_txid(inflight->last_tx, &txid);
 				json_add_txid(response, "scratch_txid", &txid);
 			}
@@ -970,11 +980,13 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 	}
 
 	if (channel->shutdown_scriptpubkey[LOCAL]) {
-		char *addr = encode_scriptpubkey_to_addr(tmpctx,
-					chainparams,
-					channel->shutdown_scriptpubkey[LOCAL]);
-		if (addr)
-			json_add_string(response, "close_to_addr", addr);
+		if (json_stream_wants(response, "close_to_addr")) {
+			char *addr = encode_scriptpubkey_to_addr(tmpctx,
+						chainparams,
+						channel->shutdown_scriptpubkey[LOCAL]);
+			if (addr)
+				json_add_string(response, "close_to_addr", addr);
+		}
 		json_add_hex_talarr(response, "close_to",
 				    channel->shutdown_scriptpubkey[LOCAL]);
 	}
@@ -1123,15 +1135,16 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 				 "our_reserve_msat",
 				 channel->channel_info.their_config.channel_reserve);
 
-	/* append spendable to JSON output */
-	json_add_amount_msat(response,
-			     "spendable_msat",
-			     channel_amount_spendable(channel));
+	/* These walk the HTLCs and recalculate fees: only do it if wanted. */
+	if (json_stream_wants(response, "spendable_msat"))
+		json_add_amount_msat(response,
+				     "spendable_msat",
+				     channel_amount_spendable(channel));
 
-	/* append receivable to JSON output */
-	json_add_amount_msat(response,
-			     "receivable_msat",
-			     channel_amount_receivable(channel));
+	if (json_stream_wants(response, "receivable_msat"))
+		json_add_amount_msat(response,
+				     "receivable_msat",
+				     channel_amount_receivable(channel));
 
 	json_add_amount_msat(response,
 			     "minimum_htlc_in_msat",
@@ -1154,22 +1167,25 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 	json_add_num(response, "max_accepted_htlcs",
 		     channel->our_config.max_accepted_htlcs);
 
-	state_changes = wallet_state_change_get(tmpctx, ld->wallet, channel->dbid);
-	json_array_start(response, "state_changes");
-	for (size_t i = 0; i < tal_count(state_changes); i++) {
-		json_object_start(response, NULL);
-		json_add_timeiso(response, "timestamp",
-				 state_changes[i].timestamp);
-		json_add_string(response, "old_state",
-				channel_state_str(state_changes[i].old_state));
-		json_add_string(response, "new_state",
-				channel_state_str(state_changes[i].new_state));
-		json_add_string(response, "cause",
-				channel_change_state_reason_str(state_changes[i].cause));
-		json_add_string(response, "message", state_changes[i].message);
-		json_object_end(response);
+	/* This can be long: don't even walk it if it's filtered out. */
+	state_changes = channel->state_changes;
+	if (json_stream_wants(response, "state_changes")) {
+		json_array_start(response, "state_changes");
+		for (size_t i = 0; i < tal_count(state_changes); i++) {
+			json_object_start(response, NULL);
+			json_add_timeiso(response, "timestamp",
+					 state_changes[i].timestamp);
+			json_add_string(response, "old_state",
+					channel_state_str(state_changes[i].old_state));
+			json_add_string(response, "new_state",
+					channel_state_str(state_changes[i].new_state));
+			json_add_string(response, "cause",
+					channel_change_state_reason_str(state_changes[i].cause));
+			json_add_string(response, "message", state_changes[i].message);
+			json_object_end(response);
+		}
+		json_array_end(response);
 	}
-	json_array_end(response);
 
 	json_array_start(response, "status");
 	for (size_t i = 0; i < ARRAY_SIZE(channel->billboard.permanent); i++) {
@@ -1183,7 +1199,7 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 	json_array_end(response);
 
 	/* Provide channel statistics */
-	wallet_channel_stats_load(ld->wallet, channel->dbid, &channel_stats);
+	channel_stats = channel->stats;
 	json_add_u64(response, "in_payments_offered",
 		     channel_stats.in_payments_offered);
 	json_add_amount_msat(response,
@@ -1205,7 +1221,9 @@ static void NON_NULL_ARGS(1, 2, 4, 5) json_add_channel(struct lightningd *ld,
 			     "out_fulfilled_msat",
 			     channel_stats.out_msatoshi_fulfilled);
 
-	json_add_htlcs(ld, response, channel);
+	/* This walks every HTLC we have, not just this channel's! */
+	if (json_stream_wants(response, "htlcs"))
+		json_add_htlcs(ld, response, channel);
 	json_object_end(response);
 }
 
@@ -1334,6 +1352,17 @@ send_error:
 							channel->peer->connectd_counter)));
 }
 
+/* peer_connected shows in listpeerchannels, so this updates them all */
+static void peer_channels_index_updated(struct peer *peer)
+{
+	struct channel *channel;
+
+	list_for_each(&peer->channels, channel, list) {
+		if (channel->created_index)
+			channel_index_updated(channel);
+	}
+}
+
 static void peer_connected_hook_final(struct peer_connected_hook_payload *payload STEALS)
 {
 	struct lightningd *ld = payload->ld;
@@ -1368,6 +1397,7 @@ static void peer_connected_hook_final(struct peer_connected_hook_payload *payloa
 	/* Now we finally consider ourselves connected! */
 	assert(peer->connected == PEER_CONNECTING);
 	peer->connected = PEER_CONNECTED;
+	peer_channels_index_updated(peer);
 
 	/* Succeed any connect() commands */
 	connect_succeeded(ld, peer, payload->incoming, &payload->addr);
@@ -1937,9 +1967,13 @@ void peer_disconnect_done(struct lightningd *ld, const u8 *msg)
 	p = peer_by_id(ld, &id);
 	if (p) {
 		struct channel *channel;
+		bool was_connected = (p->connected == PEER_CONNECTED);
 		assert(p->connectd_counter == connectd_counter);
 		log_peer_debug(ld->log, &id, "peer_disconnect_done");
 		p->connected = PEER_DISCONNECTED;
+		/* Until then, listpeerchannels said they weren't connected */
+		if (was_connected)
+			peer_channels_index_updated(p);
 
 		list_for_each(&p->channels, channel, list)
 			channel_gossip_channel_disconnect(channel);
@@ -2347,6 +2381,75 @@ static void json_add_peerchannels(struct lightningd *ld,
 	}
 }
 
+static u64 channel_index(const struct channel *channel, enum wait_index index)
+{
+	if (index == WAIT_INDEX_UPDATED)
+		return channel->updated_index;
+	return channel->created_index;
+}
+
+static int channel_index_cmp(struct channel *const *a,
+			     struct channel *const *b,
+			     enum wait_index *index)
+{
+	u64 ia = channel_index(*a, *index), ib = channel_index(*b, *index);
+
+	if (ia < ib)
+		return -1;
+	return ia > ib;
+}
+
+static void add_channels_by_index(struct channel ***chans,
+				  const struct peer *peer,
+				  enum wait_index index,
+				  u64 start)
+{
+	struct channel *channel;
+
+	/* Uncommitted channels have no index, so never appear here */
+	list_for_each(&peer->channels, channel, list) {
+		if (!channel->created_index)
+			continue;
+		if (channel_index(channel, index) < start)
+			continue;
+		tal_arr_expand(chans, channel);
+	}
+}
+
+/* Only the channels created (or updated) since @start, in index order:
+ * formatting channels is the expensive part, so this is cheap. */
+static void json_add_channels_by_index(struct lightningd *ld,
+				       struct json_stream *response,
+				       const struct node_id *peer_id,
+				       enum wait_index index,
+				       u64 start,
+				       const u32 *limit)
+{
+	struct channel **chans = tal_arr(tmpctx, struct channel *, 0);
+	struct peer *peer;
+
+	if (peer_id) {
+		peer = peer_by_id(ld, peer_id);
+		if (peer)
+			add_channels_by_index(&chans, peer, index, start);
+	} else {
+		struct peer_node_id_map_iter it;
+
+		for (peer = peer_node_id_map_first(ld->peers, &it);
+		     peer;
+		     peer = peer_node_id_map_next(ld->peers, &it)) {
+			add_channels_by_index(&chans, peer, index, start);
+		}
+	}
+
+	asort(chans, tal_count(chans), channel_index_cmp, &index);
+	for (size_t i = 0; i < tal_count(chans); i++) {
+		if (limit && i == *limit)
+			break;
+		json_add_channel(ld, response, NULL, chans[i], chans[i]->peer);
+	}
+}
+
 static struct command_result *json_listpeerchannels(struct command *cmd,
 						    const char *buffer,
 						    const jsmntok_t *obj UNNEEDED,
@@ -2355,17 +2458,39 @@ static struct command_result *json_listpeerchannels(struct command *cmd,
 	struct node_id *peer_id;
 	struct peer *peer;
 	struct json_stream *response;
+	enum wait_index *listindex;
+	u64 *liststart;
+	u32 *listlimit;
 
 	/* FIME: filter by status */
 	if (!param(cmd, buffer, params,
 		   p_opt("id", param_node_id, &peer_id),
+		   p_opt("index", param_index, &listindex),
+		   p_opt_def("start", param_u64, &liststart, 0),
+		   p_opt("limit", param_u32, &listlimit),
 		   NULL))
 		return command_param_failed();
 
+	if (listindex && *listindex == WAIT_INDEX_DELETED) {
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "Cannot list channels by {index} deleted");
+	}
+	if (*liststart != 0 && !listindex) {
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "Can only specify {start} with {index}");
+	}
+	if (listlimit && !listindex) {
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "Can only specify {limit} with {index}");
+	}
+
 	response = json_stream_success(cmd);
 	json_array_start(response, "channels");
 
-	if (peer_id) {
+	if (listindex) {
+		json_add_channels_by_index(cmd->ld, response, peer_id,
+					   *listindex, *liststart, listlimit);
+	} else if (peer_id) {
 		peer = peer_by_id(cmd->ld, peer_id);
 		if (peer)
 			json_add_peerchannels(cmd->ld, response, peer);
@@ -2515,46 +2640,33 @@ struct htlc_in_map *load_channels_from_wallet(struct lightningd *ld,
 	struct peer *peer;
 	struct htlc_in_map *unconnected_htlcs_in = tal(ld, struct htlc_in_map);
 	struct peer_node_id_map_iter it;
+	struct channel **chans = tal_arr(tmpctx, struct channel *, 0);
 
 	/* Load channels from database */
 	if (!wallet_init_channels(ld->wallet))
 		fatal("Could not load channels from the database");
 
-	*num_channels = 0;
-	/* First we load the incoming htlcs */
 	for (peer = peer_node_id_map_first(ld->peers, &it);
 	     peer;
 	     peer = peer_node_id_map_next(ld->peers, &it)) {
 		struct channel *channel;
 
-		list_for_each(&peer->channels, channel, list) {
-			if (!wallet_htlcs_load_in_for_channel(ld->wallet,
-							      channel,
-							      ld->htlcs_in)) {
-				fatal("could not load htlcs for channel");
-			}
-			(*num_channels)++;
-		}
+		list_for_each(&peer->channels, channel, list)
+			tal_arr_expand(&chans, channel);
 	}
+	*num_channels = tal_count(chans);
+
+	/* First we load the incoming htlcs */
+	if (!wallet_htlcs_load_in(ld->wallet, chans, ld->htlcs_in))
+		fatal("could not load htlcs for channels");
 
 	/* Make a copy of the htlc_map: entries removed as they're matched */
 	htlc_in_map_copy(unconnected_htlcs_in, ld->htlcs_in);
 
 	/* Now we load the outgoing HTLCs, so we can connect them. */
-	for (peer = peer_node_id_map_first(ld->peers, &it);
-	     peer;
-	     peer = peer_node_id_map_next(ld->peers, &it)) {
-		struct channel *channel;
-
-		list_for_each(&peer->channels, channel, list) {
-			if (!wallet_htlcs_load_out_for_channel(ld->wallet,
-							       channel,
-							       ld->htlcs_out,
-							       unconnected_htlcs_in)) {
-				fatal("could not load outgoing htlcs for channel");
-			}
-		}
-	}
+	if (!wallet_htlcs_load_out(ld->wallet, chans, ld->htlcs_out,
+				   unconnected_htlcs_in))
+		fatal("could not load outgoing htlcs for channels");
 
 #ifdef COMPAT_V061
 	fixup_htlcs_out(ld);
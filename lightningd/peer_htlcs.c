@@ -5,7 +5,6 @@
 #include <channeld/channeld_wiregen.h>
 #include <common/blinding.h>
 #include <common/configdir.h>
-#include <common/ecdh.h>
 #include <common/json_command.h>
 #include <common/json_param.h>
 #include <common/onion_decode.h>
@@ -350,7 +349,7 @@ void fulfill_htlc(struct htlc_in *hin, const struct preimage *preimage)
 
 	/* Update channel stats */
 	wallet_channel_stats_incr_in_fulfilled(wallet,
-					       channel->dbid,
+					       channel,
 					       hin->msat);
 
 	/* No owner?  We'll either send to channeld in peer_htlcs, or
@@ -575,6 +574,8 @@ static void rcvd_htlc_reply(struct subd *subd, const u8 *msg, const int *fds UNU
 
 	/* Add it to lookup table now we know id. */
 	connect_htlc_out(subd->ld->htlcs_out, hout);
+	/* listpeerchannels shows it already, and it's not spendable */
+	channel_index_updated_if_changed(hout->key.channel);
 
 	/* When channeld includes it in commitment, we'll make it persistent. */
 }
@@ -1127,34 +1128,6 @@ htlc_accepted_hook_final(struct htlc_accepted_hook_payload *request STEALS)
 	tal_free(request);
 }
 
-/* Apply tweak to ephemeral key if blinding is non-NULL, then do ECDH */
-static bool ecdh_maybe_blinding(const struct pubkey *ephemeral_key,
-				const struct pubkey *blinding,
-				struct secret *ss)
-{
-	struct pubkey point = *ephemeral_key;
-
-	if (blinding) {
-		struct secret hmac;
-		struct secret blinding_ss;
-
-		ecdh(blinding, &blinding_ss);
-		/* b(i) = HMAC256("blinded_node_id", ss(i)) * k(i) */
-		subkey_from_hmac("blinded_node_id", &blinding_ss, &hmac);
-
-		/* We instead tweak the *ephemeral* key from the onion and use
-		 * our normal privkey: since hsmd knows only how to ECDH with
-		 * our real key */
-		if (secp256k1_ec_pubkey_tweak_mul(secp256k1_ctx,
-						  &point.pubkey,
-						  hmac.data) != 1) {
-			return false;
-		}
-	}
-	ecdh(&point, ss);
-	return true;
-}
-
 REGISTER_PLUGIN_HOOK(htlc_accepted,
 		     htlc_accepted_hook_deserialize,
 		     htlc_accepted_hook_final,
@@ -1340,6 +1313,16 @@ static bool peer_accepted_htlc(const tal_t *ctx,
 		goto fail;
 	}
 
+	/* channeld couldn't get a shared secret from its ephemeral key */
+	if (!hin->shared_secret) {
+		*badonion = WIRE_INVALID_ONION_KEY;
+		log_debug(channel->log,
+			  "Rejecting their htlc %"PRIu64
+			  " since onion has no shared secret",
+			  id);
+		goto fail;
+	}
+
 	rs = process_onionpacket(tmpctx, op, hin->shared_secret,
 				 hin->payment_hash.u.u8,
 				 sizeof(hin->payment_hash), true);
@@ -1426,7 +1409,7 @@ static void fulfill_our_htlc_out(struct channel *channel, struct htlc_out *hout,
 			   hout->failmsg, &we_filled);
 	/* Update channel stats */
 	wallet_channel_stats_incr_out_fulfilled(ld->wallet,
-						channel->dbid,
+						channel,
 						hout->msat);
 
 	if (hout->am_origin)
@@ -1439,7 +1422,9 @@ static void fulfill_our_htlc_out(struct channel *channel, struct htlc_out *hout,
 				    fmt_amount_msat(tmpctx, hout->msat));
 		} else {
 			struct short_channel_id scid = channel_scid_or_local_alias(hout->key.channel);
-			fulfill_htlc(hout->in, preimage);
+			/* peer_got_htlc_preimage may have done this already */
+			if (!hout->in->preimage)
+				fulfill_htlc(hout->in, preimage);
 			wallet_forwarded_payment_add(ld->wallet, hout->in,
 						     FORWARD_STYLE_TLV,
 						     &scid, hout,
@@ -1469,6 +1454,40 @@ static bool peer_fulfilled_our_htlc(struct channel *channel,
 	return true;
 }
 
+/* Peer sent update_fulfill_htlc: we don't need to wait for them to commit
+ * before fulfilling upstream, since knowing the preimage is enough.  The rest
+ * (our htlc_out, forwards table) happens in peer_fulfilled_our_htlc. */
+void peer_got_htlc_preimage(struct channel *channel, const u8 *msg)
+{
+	struct lightningd *ld = channel->peer->ld;
+	struct htlc_out *hout;
+	struct preimage preimage;
+	u64 id;
+
+	if (!fromwire_channeld_got_htlc_preimage(msg, &id, &preimage)) {
+		channel_internal_error(channel,
+				       "bad channeld_got_htlc_preimage %s",
+				       tal_hex(tmpctx, msg));
+		return;
+	}
+
+	hout = find_htlc_out(ld->htlcs_out, channel, id);
+	if (!hout) {
+		channel_internal_error(channel,
+				       "got_htlc_preimage unknown htlc %"PRIu64,
+				       id);
+		return;
+	}
+
+	/* Only forwards have somewhere to send it. */
+	if (!hout->in || hout->in->preimage || hout->in->failonion)
+		return;
+
+	log_debug(channel->log, "HTLC %"PRIu64" fulfilled: passing upstream",
+		  id);
+	fulfill_htlc(hout->in, &preimage);
+}
+
 void onchain_fulfilled_htlc(struct channel *channel,
 			    const struct preimage *preimage)
 {
@@ -1900,7 +1919,7 @@ static bool update_out_htlc(struct channel *channel,
 		wallet_htlc_save_out(ld->wallet, channel, hout);
 		/* Update channel stats */
 		wallet_channel_stats_incr_out_offered(ld->wallet,
-						      channel->dbid,
+						      channel,
 						      hout->msat);
 
 		if (hout->in) {
@@ -2080,6 +2099,9 @@ void peer_sending_commitsig(struct channel *channel, const u8 *msg)
 	if (pbase)
 		wallet_penalty_base_add(ld->wallet, channel->dbid, pbase);
 
+	/* Backups must know this commitment before the peer does. */
+	plugin_hook_db_need_sync(ld);
+
 	/* Tell it we've got it, and to go ahead with commitment_signed. */
 	subd_send_msg(channel->owner,
 		      take(towire_channeld_sending_commitsig_reply(msg)));
@@ -2090,9 +2112,6 @@ static bool channel_added_their_htlc(struct channel *channel,
 {
 	struct lightningd *ld = channel->peer->ld;
 	struct htlc_in *hin;
-	struct secret shared_secret;
-	struct onionpacket *op;
-	enum onion_wire failcode;
 
 	/* BOLT #2:
 	 *
@@ -2111,26 +2130,13 @@ static bool channel_added_their_htlc(struct channel *channel,
 		return false;
 	}
 
-	/* Do the work of extracting shared secret now if possible. */
-	/* FIXME: We do this *again* in peer_accepted_htlc! */
-	op = parse_onionpacket(tmpctx, added->onion_routing_packet,
-			       sizeof(added->onion_routing_packet),
-			       &failcode);
-	if (op) {
-		if (!ecdh_maybe_blinding(&op->ephemeralkey,
-					 added->blinding,
-					 &shared_secret)) {
-			log_debug(channel->log, "htlc %"PRIu64
-				  ": can't tweak pubkey", added->id);
-			return false;
-		}
-	}
-
-	/* This stays around even if we fail it immediately: it *is*
+	/* channeld did the ECDH for us (NULL if the onion was bad).
+	 *
+	 * This stays around even if we fail it immediately: it *is*
 	 * part of the current commitment. */
 	hin = new_htlc_in(channel, channel, added->id, added->amount,
 			  added->cltv_expiry, &added->payment_hash,
-			  op ? &shared_secret : NULL,
+			  added->shared_secret,
 			  added->blinding,
 			  added->onion_routing_packet,
 			  added->fail_immediate);
@@ -2138,7 +2144,7 @@ static bool channel_added_their_htlc(struct channel *channel,
 	/* Save an incoming htlc to the wallet */
 	wallet_htlc_save_in(ld->wallet, channel, hin);
 	/* Update channel stats */
-	wallet_channel_stats_incr_in_offered(ld->wallet, channel->dbid,
+	wallet_channel_stats_incr_in_offered(ld->wallet, channel,
 					     added->amount);
 
 	log_debug(channel->log, "Adding their HTLC %"PRIu64, added->id);
@@ -2347,6 +2353,9 @@ void peer_got_commitsig(struct channel *channel, const u8 *msg)
 		i++;
 	}
 
+	/* We're about to revoke: backups must have caught up first. */
+	plugin_hook_db_need_sync(ld);
+
 	/* Tell it we've committed, and to go ahead with revoke. */
 	msg = towire_channeld_got_commitsig_reply(msg);
 	subd_send_msg(channel->owner, take(msg));
@@ -2494,6 +2503,9 @@ void peer_got_revoke(struct channel *channel, const u8 *msg)
 	/* FIXME: Check per_commitment_secret -> per_commit_point */
 	update_per_commit_point(channel, &next_per_commitment_point);
 
+	/* Backups need their revocation secret before we go on. */
+	plugin_hook_db_need_sync(ld);
+
 	/* Tell it we've committed, and to go ahead with revoke. */
 	msg = towire_channeld_got_revoke_reply(msg);
 	subd_send_msg(channel->owner, take(msg));
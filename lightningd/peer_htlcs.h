@@ -22,6 +22,7 @@ void free_htlcs(struct lightningd *ld, const struct channel *channel);
 void peer_sending_commitsig(struct channel *channel, const u8 *msg);
 void peer_got_commitsig(struct channel *channel, const u8 *msg);
 void peer_got_revoke(struct channel *channel, const u8 *msg);
+void peer_got_htlc_preimage(struct channel *channel, const u8 *msg);
 
 void update_per_commit_point(struct channel *channel,
 			     const struct pubkey *per_commitment_point);
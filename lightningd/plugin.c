@@ -65,6 +65,23 @@ static const char *state_desc(const struct plugin *plugin)
 	      plugin->plugin_state, plugin->cmd);
 }
 
+/* Entry in plugins->subscribers */
+struct plugin_subscribers {
+	const char *topic;
+	struct plugin **plugins;
+};
+
+static void memleak_help_subscribers(struct htable *memtable,
+				     struct plugins *plugins)
+{
+	memleak_scan_strmap(memtable, &plugins->subscribers);
+}
+
+static void destroy_plugins(struct plugins *plugins)
+{
+	strmap_clear(&plugins->subscribers);
+}
+
 struct plugins *plugins_new(const tal_t *ctx, struct log_book *log_book,
 			    struct lightningd *ld)
 {
@@ -79,10 +96,90 @@ struct plugins *plugins_new(const tal_t *ctx, struct log_book *log_book,
 	p->plugin_idx = 0;
 	p->dev_builtin_plugins_unimportant = false;
 	p->want_db_transaction = true;
+	strmap_init(&p->subscribers);
+	tal_add_destructor(p, destroy_plugins);
+	memleak_add_helper(p, memleak_help_subscribers);
 
 	return p;
 }
 
+/* Which topic do we file @plugin's subscription to @topic under?  NULL if
+ * its "*" subscription covers it already. */
+static const char *subscription_index_topic(const struct plugin *plugin,
+					    const char *topic)
+{
+	if (streq(topic, "*"))
+		return topic;
+	for (size_t i = 0; i < tal_count(plugin->subscriptions); i++) {
+		if (is_asterix_notification(topic, plugin->subscriptions[i]))
+			return NULL;
+	}
+	return topic;
+}
+
+static void plugin_subscribers_add(struct plugin *plugin)
+{
+	struct plugins *plugins = plugin->plugins;
+
+	for (size_t i = 0; i < tal_count(plugin->subscriptions); i++) {
+		struct plugin_subscribers *subs;
+		const char *topic;
+		size_t j;
+
+		topic = subscription_index_topic(plugin,
+						 plugin->subscriptions[i]);
+		if (!topic)
+			continue;
+
+		subs = strmap_get(&plugins->subscribers, topic);
+		if (!subs) {
+			subs = tal(plugins, struct plugin_subscribers);
+			subs->topic = tal_strdup(subs, topic);
+			subs->plugins = tal_arr(subs, struct plugin *, 0);
+			strmap_add(&plugins->subscribers, subs->topic, subs);
+		}
+
+		/* Subscribing twice doesn't get you two copies */
+		for (j = 0; j < tal_count(subs->plugins); j++) {
+			if (subs->plugins[j] == plugin)
+				break;
+		}
+		if (j == tal_count(subs->plugins))
+			tal_arr_expand(&subs->plugins, plugin);
+	}
+}
+
+static void plugin_subscribers_del(struct plugin *plugin)
+{
+	struct plugins *plugins = plugin->plugins;
+
+	for (size_t i = 0; i < tal_count(plugin->subscriptions); i++) {
+		struct plugin_subscribers *subs;
+		const char *topic;
+
+		topic = subscription_index_topic(plugin,
+						 plugin->subscriptions[i]);
+		if (!topic)
+			continue;
+
+		/* Already gone if we're shutting down, or it was a dup */
+		subs = strmap_get(&plugins->subscribers, topic);
+		if (!subs)
+			continue;
+
+		for (size_t j = 0; j < tal_count(subs->plugins); j++) {
+			if (subs->plugins[j] == plugin) {
+				tal_arr_remove(&subs->plugins, j);
+				break;
+			}
+		}
+		if (tal_count(subs->plugins) == 0) {
+			strmap_del(&plugins->subscribers, subs->topic, NULL);
+			tal_free(subs);
+		}
+	}
+}
+
 /* Check that all the plugin's subscriptions are actually for known
  * notification topics. Emit a warning if that's not the case, but
  * don't kill the plugin. */
@@ -238,6 +335,7 @@ static void plugin_terminated_fail_req(struct plugin *plugin,
 	jsmn_init(&plugin->parser);
 	toks_reset(plugin->toks);
 	tal_free(plugin->buffer);
+	plugin->attachment_end = 0;
 	plugin->buffer = tal_fmt(plugin,
 				 "{\"jsonrpc\": \"2.0\","
 				 "\"id\": %s,"
@@ -260,6 +358,7 @@ static void destroy_plugin(struct plugin *p)
 	struct jsonrpc_request **reqs;
 
 	list_del(&p->list);
+	plugin_subscribers_del(p);
 
 	/* Don't have p->conn destructor run. */
 	if (p->stdout_conn)
@@ -358,6 +457,8 @@ struct plugin *plugin_register(struct plugins *plugins, const char* path TAKES,
 	p->shortname = path_basename(p, p->cmd);
 	p->start_cmd = start_cmd;
 	p->can_check = false;
+	p->attachments = false;
+	p->attachment_end = 0;
 
 	p->plugin_state = UNCONFIGURED;
 	p->js_arr = tal_arr(p, struct json_stream *, 0);
@@ -664,6 +765,24 @@ static void plugin_response_handle(struct plugin *plugin,
 	tal_free(ctx);
 }
 
+/* Only a successful response to a request which asked for one can carry
+ * an attachment: elsewhere "attachment_length" is just another field. */
+static bool response_wants_attachment(struct plugin *plugin,
+				      const jsmntok_t *idtok)
+{
+	const struct jsonrpc_request *request;
+
+	if (!idtok
+	    || !json_get_member(plugin->buffer, plugin->toks, "result"))
+		return false;
+
+	/* Include any "" in id */
+	request = strmap_getn(&plugin->pending_requests,
+			      json_tok_full(plugin->buffer, idtok),
+			      json_tok_full_len(idtok));
+	return request && request->attachment_ok;
+}
+
 /**
  * Try to parse a complete message from the plugin's buffer.
  *
@@ -678,18 +797,26 @@ static const char *plugin_read_json_one(struct plugin *plugin,
 					bool *complete,
 					bool *destroyed)
 {
-	const jsmntok_t *jrtok, *idtok;
+	const jsmntok_t *jrtok, *idtok, *attachtok;
 	struct plugin_destroyed *pd;
 	const char *err;
 	struct wallet *wallet = plugin->plugins->ld->wallet;
+	size_t msglen;
 
 	*destroyed = false;
 	/* Note that in the case of 'plugin stop' this can free request (since
 	 * plugin is parent), so detect that case */
 
-	if (!json_parse_input(&plugin->parser, &plugin->toks,
-			      plugin->buffer, plugin->used,
-			      complete)) {
+	/* Already parsed this one, were just waiting for its attachment? */
+	if (plugin->attachment_end) {
+		if (plugin->used < plugin->attachment_end) {
+			*complete = false;
+			return NULL;
+		}
+		*complete = true;
+	} else if (!json_parse_input(&plugin->parser, &plugin->toks,
+				     plugin->buffer, plugin->used,
+				     complete)) {
 		return tal_fmt(plugin,
 			       "Failed to parse JSON response '%.*s'",
 			       (int)plugin->used, plugin->buffer);
@@ -724,6 +851,37 @@ static const char *plugin_read_json_one(struct plugin *plugin,
 		    "JSON-RPC message does not contain \"jsonrpc\" field");
 	}
 
+	/* Raw bytes follow the closing '}': we need them all before we can
+	 * hand this on. */
+	msglen = plugin->toks[0].end;
+	attachtok = NULL;
+	if (plugin->attachment_end || response_wants_attachment(plugin, idtok))
+		attachtok = json_get_member(plugin->buffer, plugin->toks,
+					    "attachment_length");
+	if (attachtok) {
+		u64 attachlen;
+
+		if (!plugin->attachments)
+			return tal_fmt(plugin,
+				       "Attachment sent without \"attachments\""
+				       " in getmanifest");
+		if (!json_to_u64(plugin->buffer, attachtok, &attachlen)
+		    || add_overflows_size_t(msglen, attachlen))
+			return tal_fmt(plugin,
+				       "Invalid attachment_length '%.*s'",
+				       json_tok_full_len(attachtok),
+				       json_tok_full(plugin->buffer, attachtok));
+		msglen += attachlen;
+		if (plugin->used < msglen) {
+			plugin->attachment_end = msglen;
+			if (tal_count(plugin->buffer) < msglen)
+				tal_resize(&plugin->buffer, msglen);
+			*complete = false;
+			return NULL;
+		}
+		plugin->attachment_end = 0;
+	}
+
 	/* We can be called extremely early, or as db hook, or for
 	 * fake "terminated" request. */
 	if (want_transaction)
@@ -783,10 +941,10 @@ static const char *plugin_read_json_one(struct plugin *plugin,
 	if (was_plugin_destroyed(pd)) {
 		*destroyed = true;
 	} else {
-		/* Move this object out of the buffer */
-		memmove(plugin->buffer, plugin->buffer + plugin->toks[0].end,
-			tal_count(plugin->buffer) - plugin->toks[0].end);
-		plugin->used -= plugin->toks[0].end;
+		/* Move this object (and any attachment) out of the buffer */
+		memmove(plugin->buffer, plugin->buffer + msglen,
+			plugin->used - msglen);
+		plugin->used -= msglen;
 		jsmn_init(&plugin->parser);
 		toks_reset(plugin->toks);
 	}
@@ -814,6 +972,12 @@ static struct io_plan *plugin_read_json(struct io_conn *conn,
 			   plugin->len_read);
 
 	plugin->used += plugin->len_read;
+
+	/* Similarly, we know exactly when an attachment is complete (and it
+	 * may well not contain a '}') */
+	if (plugin->attachment_end)
+		have_full = (plugin->used >= plugin->attachment_end);
+
 	if (plugin->used == tal_count(plugin->buffer))
 		tal_resize(&plugin->buffer, plugin->used * 2);
 
@@ -1522,13 +1686,14 @@ static const char *plugin_subscriptions_add(struct plugin *plugin,
 		topic = json_strdup(plugin, plugin->buffer, s);
 		tal_arr_expand(&plugin->subscriptions, topic);
 	}
+	plugin_subscribers_add(plugin);
 	return NULL;
 }
 
 static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 				    const jsmntok_t *resulttok)
 {
-	const jsmntok_t *t, *hookstok, *beforetok, *aftertok;
+	const jsmntok_t *t, *hookstok, *beforetok, *aftertok, *observetok, *windowtok, *filterstok;
 	size_t i;
 
 	hookstok = json_get_member(buffer, resulttok, "hooks");
@@ -1550,10 +1715,14 @@ static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 			name = json_strdup(tmpctx, buffer, nametok);
 			beforetok = json_get_member(buffer, t, "before");
 			aftertok = json_get_member(buffer, t, "after");
+			observetok = json_get_member(buffer, t, "observe");
+			windowtok = json_get_member(buffer, t, "window");
+			filterstok = json_get_member(buffer, t, "filters");
 		} else {
 			/* FIXME: deprecate in 3 releases after v0.9.2! */
 			name = json_strdup(tmpctx, plugin->buffer, t);
-			beforetok = aftertok = NULL;
+			beforetok = aftertok = observetok = windowtok = NULL;
+			filterstok = NULL;
 		}
 
 		hook = plugin_hook_register(plugin, name);
@@ -1566,6 +1735,39 @@ static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 		}
 
 		plugin_hook_add_deps(hook, plugin, buffer, beforetok, aftertok);
+		if (observetok) {
+			bool observe;
+			if (!json_to_bool(buffer, observetok, &observe))
+				return tal_fmt(plugin,
+					       "hook '%s' observe is not a bool: %.*s",
+					       name,
+					       json_tok_full_len(observetok),
+					       json_tok_full(buffer, observetok));
+			if (observe && !plugin_hook_set_observe(hook, plugin))
+				return tal_fmt(plugin,
+					       "hook '%s' cannot be observe-only",
+					       name);
+		}
+		if (windowtok) {
+			u32 window;
+			if (!json_to_u32(buffer, windowtok, &window))
+				return tal_fmt(plugin,
+					       "hook '%s' window is not a u32: %.*s",
+					       name,
+					       json_tok_full_len(windowtok),
+					       json_tok_full(buffer, windowtok));
+			if (!plugin_hook_set_window(hook, plugin, window))
+				return tal_fmt(plugin,
+					       "hook '%s' cannot have a window",
+					       name);
+		}
+		if (filterstok) {
+			const char *err;
+			err = plugin_hook_set_strfilters(plugin, hook, plugin,
+							 buffer, filterstok);
+			if (err)
+				return err;
+		}
 		tal_free(name);
 	}
 	return NULL;
@@ -1856,6 +2058,17 @@ static const char *plugin_parse_getmanifest_response(const char *buffer,
 		plugin->can_check = false;
 	}
 
+	tok = json_get_member(buffer, resulttok, "attachments");
+	if (tok) {
+		if (!json_to_bool(buffer, tok, &plugin->attachments))
+			return tal_fmt(plugin,
+				       "Invalid attachments: %.*s",
+				       json_tok_full_len(tok),
+				       json_tok_full(buffer, tok));
+	} else {
+		plugin->attachments = false;
+	}
+
 	err = plugin_notifications_add(buffer, resulttok, plugin);
 	if (!err)
 		err = plugin_opts_add(plugin, buffer, resulttok);
@@ -2060,6 +2273,7 @@ const char *plugin_send_getmanifest(struct plugin *p, const char *cmd_id)
 				    p->log, NULL, plugin_manifest_cb, p);
 	json_add_bool(req->stream, "allow-deprecated-apis",
 		      p->plugins->ld->deprecated_ok);
+	json_add_bool(req->stream, "attachments", true);
 	jsonrpc_request_end(req);
 	plugin_request_send(p, req);
 	p->plugin_state = AWAITING_GETMANIFEST_RESPONSE;
@@ -2493,22 +2707,56 @@ bool plugin_single_notify(struct plugin *p,
 	return interested;
 }
 
+static void plugin_subscribers_notify(struct plugins *plugins,
+				      const char *topic,
+				      const struct jsonrpc_notification *n)
+{
+	struct plugin_subscribers *subs;
+
+	subs = strmap_get(&plugins->subscribers, topic);
+	if (!subs)
+		return;
+
+	for (size_t i = 0; i < tal_count(subs->plugins); i++) {
+		struct plugin *p = subs->plugins[i];
+		if (p->plugin_state == INIT_COMPLETE)
+			plugin_send(p, json_stream_dup(p, n->stream, p->log));
+	}
+}
+
 void plugins_notify(struct plugins *plugins,
 		    const struct jsonrpc_notification *n TAKES)
 {
-	struct plugin *p;
-
 	if (taken(n))
 		tal_steal(tmpctx, n);
 
 	/* If we're shutting down, ld->plugins will be NULL */
 	if (plugins) {
-		list_for_each(&plugins->plugins, p, list) {
-			plugin_single_notify(p, n);
-		}
+		/* Those two sets never overlap: see plugin_subscribers_add */
+		plugin_subscribers_notify(plugins, n->method, n);
+		if (!streq(n->method, "log"))
+			plugin_subscribers_notify(plugins, "*", n);
 	}
 }
 
+const u8 *plugin_response_attachment(const char *buffer,
+				     const jsmntok_t *toks,
+				     size_t *len)
+{
+	const jsmntok_t *attachtok;
+	u64 attachlen;
+
+	attachtok = json_get_member(buffer, toks, "attachment_length");
+	if (!attachtok)
+		return NULL;
+
+	/* plugin_read_json_one checked this, and that it's all there. */
+	if (!json_to_u64(buffer, attachtok, &attachlen))
+		abort();
+	*len = attachlen;
+	return (const u8 *)buffer + toks->end;
+}
+
 void plugin_request_send(struct plugin *plugin,
 			 struct jsonrpc_request *req)
 {
@@ -2523,6 +2771,14 @@ void plugin_request_send(struct plugin *plugin,
 	req->stream = NULL;
 }
 
+void plugin_notification_send(struct plugin *plugin,
+			      const struct jsonrpc_notification *n TAKES)
+{
+	plugin_send(plugin, json_stream_dup(plugin, n->stream, plugin->log));
+	if (taken(n))
+		tal_free(n);
+}
+
 void *plugins_exclusive_loop(struct plugin **plugins)
 {
 	void *ret;
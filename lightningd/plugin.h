@@ -96,6 +96,13 @@ struct plugin {
 
 	/* Can this handle check commands? */
 	bool can_check;
+
+	/* Can this send binary attachments after its responses? */
+	bool attachments;
+
+	/* If non-zero, the message at the front of buffer has an attachment,
+	 * and we need this many bytes before we can handle it. */
+	size_t attachment_end;
 };
 
 /**
@@ -127,6 +134,10 @@ struct plugins {
 
 	/* Whether builtin plugins should be overridden as unimportant.  */
 	bool dev_builtin_plugins_unimportant;
+
+	/* Who is subscribed to each notification topic.  Plugins subscribed
+	 * to "*" are only listed there (and under "log", if they asked). */
+	STRMAP(struct plugin_subscribers *) subscribers;
 };
 
 /**
@@ -334,6 +345,28 @@ void plugins_notify(struct plugins *plugins,
 void plugin_request_send(struct plugin *plugin,
 			 struct jsonrpc_request *req);
 
+/**
+ * Send a jsonrpc_notification to the specified plugin, whether or not it
+ * subscribed (e.g. for observe-only hooks).
+ */
+void plugin_notification_send(struct plugin *plugin,
+			      const struct jsonrpc_notification *n TAKES);
+
+/**
+ * plugin_response_attachment - get the binary attachment of a response.
+ * @buffer: the buffer passed to the jsonrpc_request's response_cb
+ * @toks: the toks passed to the jsonrpc_request's response_cb
+ * @len: set to the attachment length, if any.
+ *
+ * Plugins which said "attachments" in their manifest can follow a
+ * response with raw bytes, rather than (say) a huge hex string.  Only
+ * valid for responses to requests with @attachment_ok set.
+ * Returns NULL if there's no attachment.
+ */
+const u8 *plugin_response_attachment(const char *buffer,
+				     const jsmntok_t *toks,
+				     size_t *len);
+
 /**
  * Callback called when parsing options. It just stores the value in
  * the plugin_opt
@@ -5,6 +5,7 @@
 #include <common/memleak.h>
 #include <db/exec.h>
 #include <db/utils.h>
+#include <lightningd/io_loop_with_timers.h>
 #include <lightningd/plugin_hook.h>
 
 /* Struct containing all the information needed to deserialize and
@@ -41,6 +42,17 @@ struct hook_instance {
 
 	/* Dependencies it asked for. */
 	const char **before, **after;
+
+	/* Only watching: called concurrently, response doesn't matter. */
+	bool observe;
+
+	/* db_write only: how many writes we may send before we wait for
+	 * acknowledgement (0 == wait for each one), and how many are out. */
+	u32 window;
+	size_t inflight;
+
+	/* If non-NULL, only call for payloads matching one of these */
+	const char **strfilters;
 };
 
 static struct plugin_hook **get_hooks(size_t *num)
@@ -101,12 +113,37 @@ struct plugin_hook *plugin_hook_register(struct plugin *plugin, const char *meth
 	h->plugin = plugin;
 	h->before = tal_arr(h, const char *, 0);
 	h->after = tal_arr(h, const char *, 0);
+	h->observe = false;
+	h->window = 0;
+	h->inflight = 0;
+	h->strfilters = NULL;
 	tal_add_destructor2(h, destroy_hook_instance, hook);
 
 	tal_arr_expand(&hook->hooks, h);
 	return hook;
 }
 
+/* Does this plugin want to be called for a payload with this strfilter?
+ * (NULL if the hook doesn't do filtering) */
+static bool hook_instance_wants(const struct hook_instance *h,
+				const char *strfilter)
+{
+	if (!strfilter || !h->strfilters)
+		return true;
+
+	for (size_t i = 0; i < tal_count(h->strfilters); i++) {
+		const char *f = h->strfilters[i];
+		size_t len = strlen(f);
+
+		if (len && f[len-1] == '*') {
+			if (strncmp(strfilter, f, len - 1) == 0)
+				return true;
+		} else if (streq(strfilter, f))
+			return true;
+	}
+	return false;
+}
+
 /* Mutual recursion */
 static void plugin_hook_call_next(struct plugin_hook_request *ph_req);
 static void plugin_hook_callback(const char *buffer, const jsmntok_t *toks,
@@ -189,7 +226,7 @@ static void plugin_hook_call_next(struct plugin_hook_request *ph_req)
 	const struct plugin_hook *hook = ph_req->hook;
 	struct plugin *plugin;
 
-	/* Find next non-NULL hook: call final if we're done */
+	/* Find next non-NULL, non-observer hook: call final if we're done */
 	do {
 		ph_req->hook_index++;
 		if (ph_req->hook_index >= tal_count(ph_req->hooks)) {
@@ -197,7 +234,8 @@ static void plugin_hook_call_next(struct plugin_hook_request *ph_req)
 			cleanup_ph_req(ph_req);
 			return;
 		}
-	} while (ph_req->hooks[ph_req->hook_index] == NULL);
+	} while (ph_req->hooks[ph_req->hook_index] == NULL
+		 || ph_req->hooks[ph_req->hook_index]->observe);
 
 	plugin = ph_req->hooks[ph_req->hook_index]->plugin;
 	log_trace(ph_req->ld->log, "Calling %s hook of plugin %s",
@@ -213,11 +251,67 @@ static void plugin_hook_call_next(struct plugin_hook_request *ph_req)
 	plugin_request_send(plugin, req);
 }
 
+static void plugin_hook_call_observers(struct lightningd *ld,
+				       const struct plugin_hook *hook,
+				       const char *strfilter,
+				       void *cb_arg)
+{
+	for (size_t i = 0; i < tal_count(hook->hooks); i++) {
+		struct plugin *plugin = hook->hooks[i]->plugin;
+		struct jsonrpc_notification *n;
+
+		if (!hook->hooks[i]->observe)
+			continue;
+		if (!hook_instance_wants(hook->hooks[i], strfilter))
+			continue;
+
+		log_trace(ld->log, "Calling %s hook of observer plugin %s",
+			  hook->name, plugin->shortname);
+		/* Observers only get told, so they get a notification:
+		 * there's no response for us to wait for (or leak). */
+		n = jsonrpc_notification_start(NULL, hook->name);
+		hook->serialize_payload(cb_arg, n->stream, plugin);
+		jsonrpc_notification_end(n);
+		plugin_notification_send(plugin, take(n));
+	}
+}
+
+static bool is_chained_hook(const struct hook_instance *h,
+			    const char *strfilter)
+{
+	return !h->observe && hook_instance_wants(h, strfilter);
+}
+
+static size_t num_chained_hooks(const struct plugin_hook *hook,
+				const char *strfilter)
+{
+	size_t num = 0;
+
+	for (size_t i = 0; i < tal_count(hook->hooks); i++)
+		if (is_chained_hook(hook->hooks[i], strfilter))
+			num++;
+	return num;
+}
+
 bool plugin_hook_call_(struct lightningd *ld, const struct plugin_hook *hook,
 		       const char *cmd_id TAKES,
 		       tal_t *cb_arg STEALS)
 {
-	if (tal_count(hook->hooks)) {
+	const char *strfilter;
+
+	/* We may use this multiple times below. */
+	cmd_id = tal_strdup_or_null(tmpctx, cmd_id);
+
+	if (hook->strfilter_cb)
+		strfilter = hook->strfilter_cb(cb_arg);
+	else
+		strfilter = NULL;
+
+	/* Observers are all sent the payload at once, before anyone in the
+	 * chain can change it: they never hold up the event. */
+	plugin_hook_call_observers(ld, hook, strfilter, cb_arg);
+
+	if (num_chained_hooks(hook, strfilter)) {
 		/* If we have a plugin that has registered for this
 		 * hook, serialize and call it */
 		/* FIXME: technically this is a leak, but we don't
@@ -231,9 +325,12 @@ bool plugin_hook_call_(struct lightningd *ld, const struct plugin_hook *hook,
 		ph_req->db = ld->wallet->db;
 		ph_req->ld = ld;
 		ph_req->cmd_id = tal_strdup_or_null(ph_req, cmd_id);
-		ph_req->hooks = tal_dup_talarr(ph_req,
-					       struct hook_instance *,
-					       hook->hooks);
+		/* Only those which want it: we skip observers anyway */
+		ph_req->hooks = tal_arr(ph_req, struct hook_instance *, 0);
+		for (size_t i = 0; i < tal_count(hook->hooks); i++) {
+			if (is_chained_hook(hook->hooks[i], strfilter))
+				tal_arr_expand(&ph_req->hooks, hook->hooks[i]);
+		}
 		/* If hook goes away, NULL out our snapshot */
 		for (size_t i=0; i<tal_count(ph_req->hooks); i++)
 			tal_add_destructor2(ph_req->hooks[i],
@@ -259,6 +356,18 @@ bool plugin_hook_call_(struct lightningd *ld, const struct plugin_hook *hook,
 static struct plugin_hook db_write_hook = {"db_write", NULL, NULL};
 AUTODATA(hooks, &db_write_hook);
 
+/*~ A db_write plugin which registers with a "window" doesn't have to
+ * answer each write before we commit: we stream up to that many writes
+ * ahead (the plugin sees them in data_version order), and it can answer
+ * them as it makes them durable, e.g. in batches.  We only stop when the
+ * window is full, or when we are about to tell someone about state we
+ * can't lose (see plugin_hook_db_need_sync). */
+static bool db_write_need_sync;
+
+/* Non-NULL when we are in an exclusive loop waiting for windowed plugins:
+ * set to whether we are waiting for them to finish entirely. */
+static const bool *db_write_waiting_all;
+
 /* A `db_write` for one particular plugin hook.  */
 struct db_write_hook_req {
 	struct plugin *plugin;
@@ -266,9 +375,8 @@ struct db_write_hook_req {
 	size_t *num_hooks;
 };
 
-static void db_hook_response(const char *buffer, const jsmntok_t *toks,
-			     const jsmntok_t *idtok,
-			     struct db_write_hook_req *dwh_req)
+static void db_hook_check_response(const struct plugin *plugin,
+				   const char *buffer, const jsmntok_t *toks)
 {
 	const jsmntok_t *resulttok;
 
@@ -276,7 +384,7 @@ static void db_hook_response(const char *buffer, const jsmntok_t *toks,
 	if (!resulttok)
 		fatal("Plugin '%s' returned an invalid response to the "
 		      "db_write hook: %.*s",
-		      dwh_req->plugin->cmd,
+		      plugin->cmd,
 		      json_tok_full_len(toks),
 		      json_tok_full(buffer, toks));
 
@@ -287,15 +395,22 @@ static void db_hook_response(const char *buffer, const jsmntok_t *toks,
 	if (resulttok) {
 		if (!json_tok_streq(buffer, resulttok, "continue"))
 			fatal("Plugin '%s' returned failed db_write: %.*s.",
-			      dwh_req->plugin->cmd,
+			      plugin->cmd,
 			      json_tok_full_len(toks),
 			      json_tok_full(buffer, toks));
 	} else
 		fatal("Plugin '%s' returned an invalid result to the db_write "
 		      "hook: %.*s",
-		      dwh_req->plugin->cmd,
+		      plugin->cmd,
 		      json_tok_full_len(toks),
 		      json_tok_full(buffer, toks));
+}
+
+static void db_hook_response(const char *buffer, const jsmntok_t *toks,
+			     const jsmntok_t *idtok,
+			     struct db_write_hook_req *dwh_req)
+{
+	db_hook_check_response(dwh_req->plugin, buffer, toks);
 
 	assert((*dwh_req->num_hooks) != 0);
 	--(*dwh_req->num_hooks);
@@ -308,6 +423,102 @@ static void db_hook_response(const char *buffer, const jsmntok_t *toks,
 	io_break(dwh_req->ph_req);
 }
 
+/* Are all the windowed plugins below their window (or, if @all, idle)? */
+static bool db_write_windows_ok(bool all)
+{
+	for (size_t i = 0; i < tal_count(db_write_hook.hooks); i++) {
+		const struct hook_instance *h = db_write_hook.hooks[i];
+		if (!h->window)
+			continue;
+		if (h->inflight >= (all ? 1 : h->window))
+			return false;
+	}
+	return true;
+}
+
+static void db_hook_window_response(const char *buffer, const jsmntok_t *toks,
+				    const jsmntok_t *idtok,
+				    struct hook_instance *h)
+{
+	db_hook_check_response(h->plugin, buffer, toks);
+
+	assert(h->inflight != 0);
+	h->inflight--;
+
+	if (db_write_waiting_all && db_write_windows_ok(*db_write_waiting_all)) {
+		log_debug(h->plugin->plugins->ld->log, "io_break: %s", __func__);
+		io_break(&db_write_hook);
+	}
+}
+
+/* Wait for windowed plugins to have room (or, if @all, to be idle). */
+static void db_write_windows_wait(bool all)
+{
+	struct plugin **plugin_arr;
+	void *ret;
+
+	/* We re-enter the io_loop, and anything in there which writes
+	 * can ask us to wait again: we're already doing that. */
+	if (db_write_waiting_all)
+		return;
+
+	if (db_write_windows_ok(all))
+		return;
+
+	plugin_arr = tal_arr(NULL, struct plugin *, 0);
+	for (size_t i = 0; i < tal_count(db_write_hook.hooks); i++) {
+		if (db_write_hook.hooks[i]->inflight)
+			tal_arr_expand(&plugin_arr,
+				       db_write_hook.hooks[i]->plugin);
+	}
+
+	db_write_waiting_all = &all;
+	ret = plugins_exclusive_loop(plugin_arr);
+	/* Same dance as plugin_hook_db_sync below. */
+	if (ret != &db_write_hook) {
+		void *ret2 = plugins_exclusive_loop(plugin_arr);
+		assert(ret2 == &db_write_hook);
+		log_debug(plugin_arr[0]->plugins->ld->log,
+			  "io_break: %s", __func__);
+		io_break(ret);
+	}
+	db_write_waiting_all = NULL;
+	tal_free(plugin_arr);
+}
+
+void plugin_hook_db_need_sync(struct lightningd *ld)
+{
+	db_write_need_sync = true;
+	io_loop_flush_before_poll(ld);
+}
+
+bool plugin_hook_db_flush(void)
+{
+	if (!db_write_need_sync)
+		return false;
+	db_write_windows_wait(true);
+	db_write_need_sync = false;
+	return true;
+}
+
+bool plugin_hook_db_wanted(struct db *db)
+{
+	return tal_count(db_write_hook.hooks) != 0;
+}
+
+static void db_write_request_end(struct jsonrpc_request *req,
+				 struct db *db,
+				 const char **changes)
+{
+	json_add_num(req->stream, "data_version", db_data_version_get(db));
+
+	json_array_start(req->stream, "writes");
+	for (size_t j = 0; j < tal_count(changes); j++)
+		json_add_string(req->stream, NULL, changes[j]);
+	json_array_end(req->stream);
+	jsonrpc_request_end(req);
+}
+
 void plugin_hook_db_sync(struct db *db)
 {
 	const struct plugin_hook *hook = &db_write_hook;
@@ -319,15 +530,39 @@ void plugin_hook_db_sync(struct db *db)
 	size_t i;
 	size_t num_hooks;
 
-	const char **changes = db_changes(db);
-	num_hooks = tal_count(hook->hooks);
-	if (num_hooks == 0)
+	const char **changes;
+	if (tal_count(hook->hooks) == 0)
 		return;
 
-	plugin_arr = notleak(tal_arr(NULL, struct plugin *,
-				  num_hooks));
-	for (i = 0; i < num_hooks; ++i)
-		plugin_arr[i] = hook->hooks[i]->plugin;
+	/* Only now do we turn them into SQL text. */
+	changes = db_changes(db);
+
+	/* Windowed plugins first: they only stop us if they're full. */
+	db_write_windows_wait(false);
+
+	plugin_arr = notleak(tal_arr(NULL, struct plugin *, 0));
+	for (i = 0; i < tal_count(hook->hooks); ++i) {
+		struct hook_instance *h = hook->hooks[i];
+		if (!h->window) {
+			tal_arr_expand(&plugin_arr, h->plugin);
+			continue;
+		}
+		/* FIXME: do IO logging for this! */
+		req = jsonrpc_request_start(NULL, hook->name, NULL,
+					    h->plugin->non_numeric_ids,
+					    NULL, NULL,
+					    db_hook_window_response,
+					    h);
+		db_write_request_end(req, db, changes);
+		plugin_request_send(h->plugin, req);
+		h->inflight++;
+	}
+
+	num_hooks = tal_count(plugin_arr);
+	if (num_hooks == 0) {
+		tal_free(plugin_arr);
+		return;
+	}
 
 	plugins = plugin_arr[0]->plugins;
 	ph_req = notleak(tal(hook->hooks, struct plugin_hook_request));
@@ -335,7 +570,7 @@ void plugin_hook_db_sync(struct db *db)
 	ph_req->db = db;
 	ph_req->cb_arg = &num_hooks;
 
-	for (i = 0; i < num_hooks; ++i) {
+	for (i = 0; i < tal_count(plugin_arr); ++i) {
 		/* Create an object for this plugin.  */
 		struct db_write_hook_req *dwh_req;
 		dwh_req = tal(ph_req, struct db_write_hook_req);
@@ -350,16 +585,7 @@ void plugin_hook_db_sync(struct db *db)
 					    NULL, NULL,
 					    db_hook_response,
 					    dwh_req);
-
-		json_add_num(req->stream, "data_version",
-			     db_data_version_get(db));
-
-		json_array_start(req->stream, "writes");
-		for (size_t j = 0; j < tal_count(changes); j++)
-			json_add_string(req->stream, NULL, changes[j]);
-		json_array_end(req->stream);
-		jsonrpc_request_end(req);
-
+		db_write_request_end(req, db, changes);
 		plugin_request_send(plugin_arr[i], req);
 	}
 
@@ -414,6 +640,80 @@ void plugin_hook_add_deps(struct plugin_hook *hook,
 	add_deps(&h->after, buffer, after);
 }
 
+bool plugin_hook_set_window(struct plugin_hook *hook,
+			    struct plugin *plugin,
+			    u32 window)
+{
+	/* Only db_write is synchronous enough for this to matter. */
+	if (hook != &db_write_hook)
+		return false;
+
+	for (size_t i = 0; i < tal_count(hook->hooks); i++) {
+		if (hook->hooks[i]->plugin == plugin) {
+			hook->hooks[i]->window = window;
+			return true;
+		}
+	}
+	abort();
+}
+
+const char *plugin_hook_set_strfilters(const tal_t *ctx,
+				       struct plugin_hook *hook,
+				       struct plugin *plugin,
+				       const char *buffer,
+				       const jsmntok_t *filters)
+{
+	struct hook_instance *h = NULL;
+	const jsmntok_t *t;
+	size_t i;
+
+	if (!hook->strfilter_cb)
+		return tal_fmt(ctx, "hook '%s' does not support filters",
+			       hook->name);
+
+	if (filters->type != JSMN_ARRAY)
+		return tal_fmt(ctx, "hook '%s' filters is not an array: %.*s",
+			       hook->name,
+			       json_tok_full_len(filters),
+			       json_tok_full(buffer, filters));
+
+	for (i = 0; i < tal_count(hook->hooks); i++) {
+		if (hook->hooks[i]->plugin == plugin) {
+			h = hook->hooks[i];
+			break;
+		}
+	}
+	assert(h);
+
+	h->strfilters = tal_arr(h, const char *, 0);
+	json_for_each_arr(i, t, filters) {
+		if (t->type != JSMN_STRING)
+			return tal_fmt(ctx, "hook '%s' filter is not a string: %.*s",
+				       hook->name,
+				       json_tok_full_len(t),
+				       json_tok_full(buffer, t));
+		tal_arr_expand(&h->strfilters, json_strdup(h->strfilters,
+							    buffer, t));
+	}
+	return NULL;
+}
+
+bool plugin_hook_set_observe(struct plugin_hook *hook,
+			     struct plugin *plugin)
+{
+	/* db_write is synchronous: it's all about waiting for the answer. */
+	if (hook == &db_write_hook)
+		return false;
+
+	for (size_t i = 0; i < tal_count(hook->hooks); i++) {
+		if (hook->hooks[i]->plugin == plugin) {
+			hook->hooks[i]->observe = true;
+			return true;
+		}
+	}
+	abort();
+}
+
 struct hook_node {
 	/* Is this copied into the ordered array yet? */
 	bool finished;
@@ -50,6 +50,10 @@ struct plugin_hook {
 	/* Which plugins have registered this hook? This is a `tal_arr`
 	 * initialized at creation. */
 	struct hook_instance **hooks;
+
+	/* If non-NULL, plugins can register "filters" for this hook, and
+	 * are only called if this string matches one. */
+	const char *(*strfilter_cb)(void *arg);
 };
 AUTODATA_TYPE(hooks, struct plugin_hook);
 
@@ -90,6 +94,14 @@ bool plugin_hook_continue(void *arg, const char *buffer, const jsmntok_t *toks);
  */
 #define REGISTER_PLUGIN_HOOK(name, deserialize_cb, final_cb,                   \
 			     serialize_payload, cb_arg_type)                   \
+	REGISTER_PLUGIN_HOOK_STRFILTER(name, NULL, deserialize_cb, final_cb,   \
+				       serialize_payload, cb_arg_type)
+
+/* Same, but plugins can ask to only be called when strfilter_cb() returns
+ * one of the "filters" they registered the hook with. */
+#define REGISTER_PLUGIN_HOOK_STRFILTER(name, strfilter_cb, deserialize_cb,    \
+				       final_cb, serialize_payload,           \
+				       cb_arg_type)                           \
 	struct plugin_hook name##_hook_gen = {                                 \
 	    stringify(name),                                                   \
 	    typesafe_cb_cast(                                                  \
@@ -103,6 +115,8 @@ bool plugin_hook_continue(void *arg, const char *buffer, const jsmntok_t *toks);
 		void (*)(cb_arg_type, struct json_stream *, struct plugin *),  \
 		serialize_payload),                                            \
 	    NULL, /* .plugins */                                               \
+	    typesafe_cb_cast(const char *(*)(void *),                          \
+			     const char *(*)(cb_arg_type), strfilter_cb),      \
 	};                                                                     \
 	AUTODATA(hooks, &name##_hook_gen);                                     \
 	PLUGIN_HOOK_CALL_DEF(name, cb_arg_type)
@@ -113,6 +127,18 @@ struct plugin_hook *plugin_hook_register(struct plugin *plugin,
 /* Special sync plugin hook for db. */
 void plugin_hook_db_sync(struct db *db);
 
+/* We're about to tell someone about state which must not be lost (e.g.
+ * revoking a commitment): db_write plugins which accept writes ahead of
+ * acknowledging them must catch up before plugin_hook_db_flush returns. */
+void plugin_hook_db_need_sync(struct lightningd *ld);
+
+/* Called before we next poll (see io_loop_with_timers()): waits if plugin_hook_db_need_sync, and
+ * returns true if so (so any other backups can be synced too). */
+bool plugin_hook_db_flush(void);
+
+/* Is anyone registered for the db hook?  If not, db needn't record changes. */
+bool plugin_hook_db_wanted(struct db *db);
+
 /* Add dependencies for this hook. */
 void plugin_hook_add_deps(struct plugin_hook *hook,
 			  struct plugin *plugin,
@@ -120,6 +146,28 @@ void plugin_hook_add_deps(struct plugin_hook *hook,
 			  const jsmntok_t *before,
 			  const jsmntok_t *after);
 
+/* Mark this plugin's registration for this hook as observe-only: it is
+ * called alongside the others, and its response is ignored.  Returns false
+ * if the hook doesn't allow that. */
+bool plugin_hook_set_observe(struct plugin_hook *hook,
+			     struct plugin *plugin);
+
+/* Only call this plugin's hook when the payload matches one of @filters
+ * (an array of strings; a trailing '*' matches any suffix).  Returns an
+ * error message if the hook doesn't support filtering or @filters is
+ * malformed. */
+const char *plugin_hook_set_strfilters(const tal_t *ctx,
+				       struct plugin_hook *hook,
+				       struct plugin *plugin,
+				       const char *buffer,
+				       const jsmntok_t *filters);
+
+/* Let this plugin's db_write hook have up to @window writes outstanding
+ * before we wait for it.  Returns false if the hook isn't db_write. */
+bool plugin_hook_set_window(struct plugin_hook *hook,
+			    struct plugin *plugin,
+			    u32 window);
+
 /* Returns array of plugins which cannot be ordered (empty on success) */
 struct plugin **plugin_hooks_make_ordered(const tal_t *ctx);
 
@@ -13,6 +13,7 @@
 #include <db/exec.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <lightningd/io_loop_with_timers.h>
 #include <lightningd/lightningd.h>
 #include <lightningd/log_status.h>
 #include <lightningd/peer_fd.h>
@@ -481,6 +482,9 @@ static struct io_plan *sd_msg_read(struct io_conn *conn, struct subd *sd)
 	struct io_plan *plan;
 	unsigned int i;
 	bool freed = false;
+	/* Channel daemons' messages (HTLC updates in particular) are
+	 * committed as a group: see io_loop_flush_before_poll(). */
+	bool group_commit = (sd->channel != NULL);
 
 	/* Everything we do, we wrap in a database transaction */
 	db_begin_transaction(db);
@@ -580,7 +584,13 @@ malformed:
 close:
 	plan = io_close(conn);
 out:
-	db_commit_transaction(db);
+	/* This is safe because anything we queued for the subdaemon
+	 * can't be written until we poll() again. */
+	if (group_commit) {
+		db_commit_transaction_deferred(db);
+		io_loop_flush_before_poll(sd->ld);
+	} else
+		db_commit_transaction(db);
 	return plan;
 }
 
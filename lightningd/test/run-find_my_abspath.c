@@ -47,12 +47,24 @@ void db_begin_transaction_(struct db *db UNNEEDED, const char *location UNNEEDED
 /* Generated stub for db_commit_transaction */
 void db_commit_transaction(struct db *db UNNEEDED)
 { fprintf(stderr, "db_commit_transaction called!\n"); abort(); }
+/* Generated stub for db_commit_transaction_deferred */
+void db_commit_transaction_deferred(struct db *db UNNEEDED)
+{ fprintf(stderr, "db_commit_transaction_deferred called!\n"); abort(); }
+/* Generated stub for db_flush_deferred_commit */
+bool db_flush_deferred_commit(struct db *db UNNEEDED)
+{ fprintf(stderr, "db_flush_deferred_commit called!\n"); abort(); }
 /* Generated stub for db_get_intvar */
 s64 db_get_intvar(struct db *db UNNEEDED, const char *varname UNNEEDED, s64 defval UNNEEDED)
 { fprintf(stderr, "db_get_intvar called!\n"); abort(); }
 /* Generated stub for db_in_transaction */
 bool db_in_transaction(struct db *db UNNEEDED)
 { fprintf(stderr, "db_in_transaction called!\n"); abort(); }
+/* Generated stub for db_stmt_cache_stats */
+void db_stmt_cache_stats(const struct db *db UNNEEDED, size_t *hits UNNEEDED, size_t *misses UNNEEDED)
+{ fprintf(stderr, "db_stmt_cache_stats called!\n"); abort(); }
+/* Generated stub for db_sync_replica */
+void db_sync_replica(struct db *db UNNEEDED)
+{ fprintf(stderr, "db_sync_replica called!\n"); abort(); }
 /* Generated stub for deprecated_ok_ */
 bool  deprecated_ok_(bool deprecated_apis UNNEEDED,
 		    const char *feature UNNEEDED,
@@ -192,6 +204,12 @@ struct logger *new_logger(const tal_t *ctx UNNEEDED, struct log_book *record UNN
 /* Generated stub for new_peer_fd_arr */
 struct peer_fd *new_peer_fd_arr(const tal_t *ctx UNNEEDED, const int *fd UNNEEDED)
 { fprintf(stderr, "new_peer_fd_arr called!\n"); abort(); }
+/* Generated stub for new_reltimer_ */
+struct oneshot *new_reltimer_(struct timers *timers UNNEEDED,
+			      const tal_t *ctx UNNEEDED,
+			      struct timerel expire UNNEEDED,
+			      void (*cb)(void *) UNNEEDED, void *arg UNNEEDED)
+{ fprintf(stderr, "new_reltimer_ called!\n"); abort(); }
 /* Generated stub for new_topology */
 struct chain_topology *new_topology(struct lightningd *ld UNNEEDED, struct logger *log UNNEEDED)
 { fprintf(stderr, "new_topology called!\n"); abort(); }
@@ -204,6 +222,12 @@ bool plugin_hook_call_(struct lightningd *ld UNNEEDED,
 		       const char *cmd_id TAKES UNNEEDED,
 		       tal_t *cb_arg STEALS UNNEEDED)
 { fprintf(stderr, "plugin_hook_call_ called!\n"); abort(); }
+/* Generated stub for plugin_hook_db_flush */
+bool plugin_hook_db_flush(void)
+{ fprintf(stderr, "plugin_hook_db_flush called!\n"); abort(); }
+/* Generated stub for plugin_hook_db_need_sync */
+void plugin_hook_db_need_sync(struct lightningd *ld UNNEEDED)
+{ fprintf(stderr, "plugin_hook_db_need_sync called!\n"); abort(); }
 /* Generated stub for plugins_config */
 bool plugins_config(struct plugins *plugins UNNEEDED)
 { fprintf(stderr, "plugins_config called!\n"); abort(); }
@@ -281,6 +305,9 @@ void waitblockheight_notify_new_block(struct lightningd *ld UNNEEDED,
 /* Generated stub for wallet_blocks_heights */
 void wallet_blocks_heights(struct wallet *w UNNEEDED, u32 def UNNEEDED, u32 *min UNNEEDED, u32 *max UNNEEDED)
 { fprintf(stderr, "wallet_blocks_heights called!\n"); abort(); }
+/* Generated stub for wallet_channel_stats_flush */
+void wallet_channel_stats_flush(struct wallet *w UNNEEDED, struct channel *chan UNNEEDED)
+{ fprintf(stderr, "wallet_channel_stats_flush called!\n"); abort(); }
 /* Generated stub for wallet_new */
 struct wallet *wallet_new(struct lightningd *ld UNNEEDED, struct timers *timers UNNEEDED)
 { fprintf(stderr, "wallet_new called!\n"); abort(); }
@@ -102,6 +102,9 @@ struct htlc_in *channel_has_htlc_in(struct channel *channel UNNEEDED)
 /* Generated stub for channel_has_htlc_out */
 struct htlc_out *channel_has_htlc_out(struct channel *channel UNNEEDED)
 { fprintf(stderr, "channel_has_htlc_out called!\n"); abort(); }
+/* Generated stub for channel_index_updated */
+void channel_index_updated(struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_index_updated called!\n"); abort(); }
 /* Generated stub for channel_internal_error */
 void channel_internal_error(struct channel *channel UNNEEDED, const char *fmt UNNEEDED, ...)
 { fprintf(stderr, "channel_internal_error called!\n"); abort(); }
@@ -142,6 +145,14 @@ void channeld_tell_depth(struct channel *channel UNNEEDED,
 const char *cmd_id_from_close_command(const tal_t *ctx UNNEEDED,
 				      struct lightningd *ld UNNEEDED, struct channel *channel UNNEEDED)
 { fprintf(stderr, "cmd_id_from_close_command called!\n"); abort(); }
+/* Generated stub for command_batched_ */
+struct command_result *command_batched_(struct command *cmd UNNEEDED,
+					const char *fieldname UNNEEDED,
+					u32 (*batch)(struct command *cmd,
+						     u32 max,
+						     void *arg) UNNEEDED,
+					void *arg UNNEEDED)
+{ fprintf(stderr, "command_batched_ called!\n"); abort(); }
 /* Generated stub for command_check_done */
 struct command_result *command_check_done(struct command *cmd)
 
@@ -165,6 +176,11 @@ struct command_result *command_its_complicated(const char *why UNNEEDED)
 /* Generated stub for command_log */
 struct logger *command_log(struct command *cmd UNNEEDED)
 { fprintf(stderr, "command_log called!\n"); abort(); }
+/* Generated stub for command_next_batch_ */
+void command_next_batch_(struct command *cmd UNNEEDED,
+			 void (*cb)(void *arg) UNNEEDED,
+			 void *arg UNNEEDED)
+{ fprintf(stderr, "command_next_batch_ called!\n"); abort(); }
 /* Generated stub for command_param_failed */
 struct command_result *command_param_failed(void)
 
@@ -413,6 +429,12 @@ bool invoices_delete_description(struct invoices *invoices UNNEEDED,
 				 const struct json_escape *label UNNEEDED,
 				 const char *description UNNEEDED)
 { fprintf(stderr, "invoices_delete_description called!\n"); abort(); }
+/* Generated stub for invoices_delete_older */
+u32 invoices_delete_older(struct invoices *invoices UNNEEDED,
+			  enum invoice_status status UNNEEDED,
+			  u64 before UNNEEDED,
+			  u32 max UNNEEDED)
+{ fprintf(stderr, "invoices_delete_older called!\n"); abort(); }
 /* Generated stub for invoices_find_by_fallback_script */
 bool invoices_find_by_fallback_script(struct invoices *invoices UNNEEDED,
 			    u64 *inv_dbid UNNEEDED,
@@ -623,6 +645,9 @@ struct json_stream *json_stream_fail(struct command *cmd UNNEEDED,
 /* Generated stub for json_stream_success */
 struct json_stream *json_stream_success(struct command *cmd UNNEEDED)
 { fprintf(stderr, "json_stream_success called!\n"); abort(); }
+/* Generated stub for json_stream_wants */
+bool json_stream_wants(const struct json_stream *js UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_stream_wants called!\n"); abort(); }
 /* Generated stub for json_to_address_scriptpubkey */
 enum address_parse_result json_to_address_scriptpubkey(const tal_t *ctx UNNEEDED,
 			     const struct chainparams *chainparams UNNEEDED,
@@ -997,9 +1022,6 @@ const char *version(void)
 /* Generated stub for wallet_channel_save */
 void wallet_channel_save(struct wallet *w UNNEEDED, struct channel *chan UNNEEDED)
 { fprintf(stderr, "wallet_channel_save called!\n"); abort(); }
-/* Generated stub for wallet_channel_stats_load */
-void wallet_channel_stats_load(struct wallet *w UNNEEDED, u64 cdbid UNNEEDED, struct channel_stats *stats UNNEEDED)
-{ fprintf(stderr, "wallet_channel_stats_load called!\n"); abort(); }
 /* Generated stub for wallet_channeltxs_add */
 void wallet_channeltxs_add(struct wallet *w UNNEEDED, struct channel *chan UNNEEDED,
 			    const int type UNNEEDED, const struct bitcoin_txid *txid UNNEEDED,
@@ -1014,17 +1036,17 @@ int wallet_extract_owned_outputs(struct wallet *w UNNEEDED, const struct wally_t
 				 const u32 *blockheight UNNEEDED,
 				 struct amount_sat *total UNNEEDED)
 { fprintf(stderr, "wallet_extract_owned_outputs called!\n"); abort(); }
-/* Generated stub for wallet_htlcs_load_in_for_channel */
-bool wallet_htlcs_load_in_for_channel(struct wallet *wallet UNNEEDED,
-				      struct channel *chan UNNEEDED,
-				      struct htlc_in_map *htlcs_in UNNEEDED)
-{ fprintf(stderr, "wallet_htlcs_load_in_for_channel called!\n"); abort(); }
-/* Generated stub for wallet_htlcs_load_out_for_channel */
-bool wallet_htlcs_load_out_for_channel(struct wallet *wallet UNNEEDED,
-				       struct channel *chan UNNEEDED,
-				       struct htlc_out_map *htlcs_out UNNEEDED,
-				       struct htlc_in_map *remaining_htlcs_in UNNEEDED)
-{ fprintf(stderr, "wallet_htlcs_load_out_for_channel called!\n"); abort(); }
+/* Generated stub for wallet_htlcs_load_in */
+bool wallet_htlcs_load_in(struct wallet *wallet UNNEEDED,
+			  struct channel **chans UNNEEDED,
+			  struct htlc_in_map *htlcs_in UNNEEDED)
+{ fprintf(stderr, "wallet_htlcs_load_in called!\n"); abort(); }
+/* Generated stub for wallet_htlcs_load_out */
+bool wallet_htlcs_load_out(struct wallet *wallet UNNEEDED,
+			   struct channel **chans UNNEEDED,
+			   struct htlc_out_map *htlcs_out UNNEEDED,
+			   struct htlc_in_map *remaining_htlcs_in UNNEEDED)
+{ fprintf(stderr, "wallet_htlcs_load_out called!\n"); abort(); }
 /* Generated stub for wallet_init_channels */
 bool wallet_init_channels(struct wallet *w UNNEEDED)
 { fprintf(stderr, "wallet_init_channels called!\n"); abort(); }
@@ -1036,11 +1058,6 @@ char *wallet_offer_find(const tal_t *ctx UNNEEDED,
 			enum offer_status *status)
 
 { fprintf(stderr, "wallet_offer_find called!\n"); abort(); }
-/* Generated stub for wallet_state_change_get */
-struct state_change_entry *wallet_state_change_get(const tal_t *ctx UNNEEDED,
-						   struct wallet *w UNNEEDED,
-						   u64 channel_id UNNEEDED)
-{ fprintf(stderr, "wallet_state_change_get called!\n"); abort(); }
 /* Generated stub for wallet_total_forward_fees */
 struct amount_msat wallet_total_forward_fees(struct wallet *w UNNEEDED)
 { fprintf(stderr, "wallet_total_forward_fees called!\n"); abort(); }
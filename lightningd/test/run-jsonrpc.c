@@ -342,6 +342,111 @@ static void test_json_stream(void)
 	tal_free(toks);
 }
 
+static struct io_plan *dummy_reader_cb(struct io_conn *conn UNNEEDED,
+				       struct json_stream *js UNNEEDED,
+				       void *arg UNNEEDED)
+{
+	abort();
+}
+
+static void set_bool(bool *b)
+{
+	*b = true;
+}
+
+/* Once being output, a big response is cut into chunks as it's written. */
+static void test_json_stream_chunks(void)
+{
+	struct json_stream *js = new_json_stream(NULL, NULL, NULL);
+	char *expected = tal_strdup(js, "{\"x\":[");
+	char *actual;
+	const char *p;
+	size_t len;
+	bool drained = false;
+
+	/* Pretend json_stream_output() was called. */
+	js->reader_cb = dummy_reader_cb;
+
+	json_object_start(js, NULL);
+	json_array_start(js, "x");
+	for (size_t i = 0; i < 100000; i++) {
+		json_object_start(js, NULL);
+		json_add_u64(js, "i", i);
+		json_object_end(js);
+		tal_append_fmt(&expected, "%s{\"i\":%zu}", i ? "," : "", i);
+
+		/* jout itself never gets much bigger than a chunk */
+		json_out_contents(js->jout, &len);
+		assert(len < JSON_STREAM_CHUNK + 100);
+	}
+	json_array_end(js);
+	json_object_end(js);
+	json_stream_double_cr(js);
+	tal_append_fmt(&expected, "]}\n\n");
+
+	assert(tal_count(js->chunks) > 1);
+	assert(json_stream_backed_up(js));
+	json_stream_when_drained(js, set_bool, &drained);
+	assert(!drained);
+
+	/* Read it out the way json_stream_output_write does. */
+	actual = tal_strdup(js, "");
+	while (tal_count(js->chunks)) {
+		tal_append_fmt(&actual, "%.*s",
+			       (int)tal_count(js->chunks[0]), js->chunks[0]);
+		js->chunks_len -= tal_count(js->chunks[0]);
+		tal_delink(js->chunks, js->chunks[0]);
+		tal_arr_remove(&js->chunks, 0);
+		json_stream_check_drained(js);
+		assert(drained == !json_stream_backed_up(js));
+	}
+	assert(drained);
+	p = json_out_contents(js->jout, &len);
+	tal_append_fmt(&actual, "%.*s", (int)len, p);
+	assert(streq(actual, expected));
+
+	/* If nobody is reading, we're never backed up. */
+	json_stream_output_abandoned(js);
+	assert(!json_stream_backed_up(js));
+	tal_free(js);
+}
+
+/* Notification fan-out shares the contents between copies. */
+static void test_json_stream_dup(void)
+{
+	struct json_stream *js = new_json_stream(NULL, NULL, NULL);
+	struct json_stream *dup1, *dup2;
+	const char *p;
+	size_t len;
+
+	json_object_start(js, NULL);
+	json_add_string(js, "method", "flood");
+	json_object_end(js);
+	json_stream_double_cr(js);
+
+	dup1 = json_stream_dup(NULL, js, NULL);
+	dup2 = json_stream_dup(NULL, js, NULL);
+	tal_free(js);
+
+	p = "{\"method\":\"flood\"}\n\n";
+	assert(tal_count(dup1->chunks) == 1);
+	assert(tal_count(dup2->chunks) == 1);
+	assert(dup1->chunks[0] == dup2->chunks[0]);
+	/* Both know how much they have to write */
+	assert(dup1->chunks_len == strlen(p));
+	assert(dup2->chunks_len == strlen(p));
+	json_out_contents(dup1->jout, &len);
+	assert(len == 0);
+
+	assert(tal_count(dup1->chunks[0]) == strlen(p));
+	assert(memcmp(dup1->chunks[0], p, strlen(p)) == 0);
+
+	/* Still there for dup2 after dup1 is done with it. */
+	tal_free(dup1);
+	assert(memcmp(dup2->chunks[0], p, strlen(p)) == 0);
+	tal_free(dup2);
+}
+
 int main(int argc, char *argv[])
 {
 	common_setup(argv[0]);
@@ -350,6 +455,8 @@ int main(int argc, char *argv[])
 	test_json_escape();
 	test_json_partial();
 	test_json_stream();
+	test_json_stream_chunks();
+	test_json_stream_dup();
 
 	common_shutdown();
 }
@@ -47,6 +47,9 @@ void db_begin_transaction_(struct db *db UNNEEDED, const char *location UNNEEDED
 /* Generated stub for db_commit_transaction */
 void db_commit_transaction(struct db *db UNNEEDED)
 { fprintf(stderr, "db_commit_transaction called!\n"); abort(); }
+/* Generated stub for db_commit_transaction_deferred */
+void db_commit_transaction_deferred(struct db *db UNNEEDED)
+{ fprintf(stderr, "db_commit_transaction_deferred called!\n"); abort(); }
 /* Generated stub for db_in_transaction */
 bool db_in_transaction(struct db *db UNNEEDED)
 { fprintf(stderr, "db_in_transaction called!\n"); abort(); }
@@ -75,6 +78,9 @@ bool fromwire_status_peer_error(const tal_t *ctx UNNEEDED, const void *p UNNEEDE
 /* Generated stub for fromwire_status_version */
 bool fromwire_status_version(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, wirestring **version UNNEEDED)
 { fprintf(stderr, "fromwire_status_version called!\n"); abort(); }
+/* Generated stub for io_loop_flush_before_poll */
+void io_loop_flush_before_poll(struct lightningd *ld UNNEEDED)
+{ fprintf(stderr, "io_loop_flush_before_poll called!\n"); abort(); }
 /* Generated stub for log_ */
 void log_(struct logger *logger UNNEEDED, enum log_level level UNNEEDED,
 	  const struct node_id *node_id UNNEEDED,
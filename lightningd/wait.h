@@ -5,13 +5,14 @@
 
 struct lightningd;
 
-/* This WAIT_SUBSYSTEM_X corresponds to listXs */
+/* This WAIT_SUBSYSTEM_X corresponds to listXs (channels: listpeerchannels) */
 enum wait_subsystem {
 	WAIT_SUBSYSTEM_FORWARD,
 	WAIT_SUBSYSTEM_SENDPAY,
 	WAIT_SUBSYSTEM_INVOICE,
+	WAIT_SUBSYSTEM_CHANNEL,
 };
-#define NUM_WAIT_SUBSYSTEM (WAIT_SUBSYSTEM_INVOICE+1)
+#define NUM_WAIT_SUBSYSTEM (WAIT_SUBSYSTEM_CHANNEL+1)
 
 enum wait_index {
 	WAIT_INDEX_CREATED,
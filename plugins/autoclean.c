@@ -52,6 +52,8 @@ struct clean_info {
 	size_t cleanup_reqs_remaining;
 	u64 subsystem_age[NUM_SUBSYSTEM];
 	u64 num_cleaned[NUM_SUBSYSTEM];
+	/* Only counted for autoclean-once */
+	bool counted_uncleaned;
 	u64 num_uncleaned;
 };
 
@@ -122,12 +124,16 @@ static struct command_result *clean_finished(struct clean_info *cinfo)
 	}
 }
 
+static struct command_result *count_uncleaned(struct clean_info *cinfo);
+
 static struct command_result *clean_finished_one(struct clean_info *cinfo)
 {
 	assert(cinfo->cleanup_reqs_remaining != 0);
 	if (--cinfo->cleanup_reqs_remaining > 0)
 		return command_still_pending(cinfo->cmd);
 
+	if (cinfo->cmd && !cinfo->counted_uncleaned)
+		return count_uncleaned(cinfo);
 	return clean_finished(cinfo);
 }
 
@@ -142,8 +148,16 @@ static struct command_result *del_done(struct command *cmd,
 				       struct del_data *del_data)
 {
 	struct clean_info *cinfo = del_data->cinfo;
+	u64 deleted;
+
+	if (!json_to_u64(buf, json_get_member(buf, result, "deleted"),
+			 &deleted))
+		plugin_err(plugin, "Bad %s del response: %.*s",
+			   subsystem_to_str(del_data->subsystem),
+			   json_tok_full_len(result),
+			   json_tok_full(buf, result));
 
-	cinfo->num_cleaned[del_data->subsystem]++;
+	cinfo->num_cleaned[del_data->subsystem] += deleted;
 	tal_free(del_data);
 	return clean_finished_one(cinfo);
 }
@@ -163,270 +177,108 @@ static struct command_result *del_failed(struct command *cmd,
 	return clean_finished_one(cinfo);
 }
 
-static struct out_req *del_request_start(const char *method,
-					 struct clean_info *cinfo,
-					 enum subsystem subsystem)
+/* lightningd deletes everything old enough, in batches, for us. */
+static void del_request(const char *method,
+			struct clean_info *cinfo,
+			enum subsystem subsystem,
+			const char *status)
 {
 	struct del_data *del_data = tal(plugin, struct del_data);
+	struct out_req *req;
 
 	del_data->cinfo = cinfo;
 	del_data->subsystem = subsystem;
 	cinfo->cleanup_reqs_remaining++;
-	return jsonrpc_request_start(plugin, NULL, method,
-				     del_done, del_failed, del_data);
+	req = jsonrpc_request_start(plugin, NULL, method,
+				    del_done, del_failed, del_data);
+	json_add_string(req->js, "status", status);
+	json_add_u64(req->js, "age", cinfo->subsystem_age[subsystem]);
+	send_outreq(plugin, req);
 }
 
-static struct command_result *listinvoices_done(struct command *cmd,
-						const char *buf,
-						const jsmntok_t *result,
-						struct clean_info *cinfo)
+static struct command_result *list_done(struct command *cmd,
+					const char *buf,
+					const jsmntok_t *resp,
+					struct clean_info *cinfo)
 {
-	const jsmntok_t *t, *inv = json_get_member(buf, result, "invoices");
-	size_t i;
-	u64 now = time_now().ts.tv_sec;
-
-	json_for_each_arr(i, t, inv) {
-		const jsmntok_t *status = json_get_member(buf, t, "status");
-		const jsmntok_t *time;
-		enum subsystem subsys;
-		u64 invtime;
-
-		if (json_tok_streq(buf, status, "expired")) {
-			subsys = EXPIREDINVOICES;
-			time = json_get_member(buf, t, "expires_at");
-		} else if (json_tok_streq(buf, status, "paid")) {
-			subsys = PAIDINVOICES;
-			time = json_get_member(buf, t, "paid_at");
-		} else {
-			cinfo->num_uncleaned++;
-			continue;
-		}
-
-		/* Continue if we don't care. */
-		if (cinfo->subsystem_age[subsys] == 0) {
-			cinfo->num_uncleaned++;
-			continue;
-		}
+	const jsmntok_t *result = json_get_member(buf, resp, "result");
 
-		if (!json_to_u64(buf, time, &invtime)) {
-			plugin_err(plugin, "Bad time '%.*s'",
-				   json_tok_full_len(time),
-				   json_tok_full(buf, time));
-		}
-
-		if (invtime <= now - cinfo->subsystem_age[subsys]) {
-			struct out_req *req;
-			const jsmntok_t *label = json_get_member(buf, t, "label");
-
-			req = del_request_start("delinvoice", cinfo, subsys);
-			json_add_tok(req->js, "label", label, buf);
-			json_add_tok(req->js, "status", status, buf);
-			send_outreq(plugin, req);
-		} else
-			cinfo->num_uncleaned++;
-	}
+	/* Our filter means it's just the one array member */
+	if (!result || result->size != 1 || result[2].type != JSMN_ARRAY)
+		return cmd_failed(cmd, buf, resp, "list");
 
+	cinfo->num_uncleaned += result[2].size;
 	return clean_finished_one(cinfo);
 }
 
-static struct command_result *listsendpays_done(struct command *cmd,
-						const char *buf,
-						const jsmntok_t *result,
-						struct clean_info *cinfo)
+static void list_request(const char *method,
+			 const char *arrname,
+			 struct clean_info *cinfo)
 {
-	const jsmntok_t *t, *pays = json_get_member(buf, result, "payments");
-	size_t i;
-	u64 now = time_now().ts.tv_sec;
-
-	json_for_each_arr(i, t, pays) {
-		const jsmntok_t *status = json_get_member(buf, t, "status");
-		const jsmntok_t *time;
-		enum subsystem subsys;
-		u64 paytime;
-
-		if (json_tok_streq(buf, status, "failed")) {
-			subsys = FAILEDPAYS;
-		} else if (json_tok_streq(buf, status, "complete")) {
-			subsys = SUCCEEDEDPAYS;
-		} else {
-			cinfo->num_uncleaned++;
-			continue;
-		}
-
-		/* Continue if we don't care. */
-		if (cinfo->subsystem_age[subsys] == 0) {
-			cinfo->num_uncleaned++;
-			continue;
-		}
-
-		time = json_get_member(buf, t, "created_at");
-		if (!json_to_u64(buf, time, &paytime)) {
-			plugin_err(plugin, "Bad created_at '%.*s'",
-				   json_tok_full_len(time),
-				   json_tok_full(buf, time));
-		}
-
-		if (paytime <= now - cinfo->subsystem_age[subsys]) {
-			struct out_req *req;
-			const jsmntok_t *phash = json_get_member(buf, t, "payment_hash");
-			const jsmntok_t *groupid = json_get_member(buf, t, "groupid");
-			const jsmntok_t *partidtok = json_get_member(buf, t, "partid");
-			u64 partid;
-			if (partidtok)
-				json_to_u64(buf, partidtok, &partid);
-			else
-				partid = 0;
-
-			req = del_request_start("delpay", cinfo, subsys);
-			json_add_tok(req->js, "payment_hash", phash, buf);
-			json_add_tok(req->js, "status", status, buf);
-			json_add_tok(req->js, "groupid", groupid, buf);
-			json_add_u64(req->js, "partid", partid);
-			send_outreq(plugin, req);
-		}
-	}
+	struct out_req *req;
 
-	return clean_finished_one(cinfo);
+	cinfo->cleanup_reqs_remaining++;
+	req = jsonrpc_request_whole_object_start(plugin, NULL, method,
+						 json_id_prefix(tmpctx, NULL),
+						 list_done, cinfo);
+	json_object_start(req->js, "params");
+	json_object_end(req->js);
+	/* We only want to count them, so don't make lightningd format
+	 * anything but the status. */
+	json_object_start(req->js, "filter");
+	json_array_start(req->js, arrname);
+	json_object_start(req->js, NULL);
+	json_add_bool(req->js, "status", true);
+	json_object_end(req->js);
+	json_array_end(req->js);
+	json_object_end(req->js);
+	send_outreq(plugin, req);
 }
 
-static struct command_result *listforwards_done(struct command *cmd,
-						const char *buf,
-						const jsmntok_t *result,
-						struct clean_info *cinfo)
+/* autoclean-once reports how many entries are left, once we're done. */
+static struct command_result *count_uncleaned(struct clean_info *cinfo)
 {
-	const jsmntok_t *t, *fwds = json_get_member(buf, result, "forwards");
-	size_t i;
-	u64 now = time_now().ts.tv_sec;
-
-	json_for_each_arr(i, t, fwds) {
-		const jsmntok_t *status = json_get_member(buf, t, "status");
-		const char *timefield = "resolved_time";
-		jsmntok_t time;
-		enum subsystem subsys;
-		u64 restime;
-
-		if (json_tok_streq(buf, status, "settled")) {
-			subsys = SUCCEEDEDFORWARDS;
-		} else if (json_tok_streq(buf, status, "failed")
-			   || json_tok_streq(buf, status, "local_failed")) {
-			subsys = FAILEDFORWARDS;
-			/* There's no resolved_time for these, so use received */
-			timefield = "received_time";
-		} else {
-			cinfo->num_uncleaned++;
-			continue;
-		}
-
-		/* Continue if we don't care. */
-		if (cinfo->subsystem_age[subsys] == 0) {
-			cinfo->num_uncleaned++;
-			continue;
-		}
-
-		/* Check if we have a resolved_time, before making a
-		 * decision on it. This is possible in older nodes
-		 * that predate our annotations for forwards.*/
-		if (json_get_member(buf, t, timefield) == NULL) {
-			cinfo->num_uncleaned++;
-			continue;
-		}
-
-
-		time = *json_get_member(buf, t, timefield);
-		/* This is a float, so truncate at '.' */
-		for (int off = time.start; off < time.end; off++) {
-			if (buf[off] == '.')
-				time.end = off;
-		}
-		if (!json_to_u64(buf, &time, &restime)) {
-			plugin_err(plugin, "Bad time '%.*s'",
-				   json_tok_full_len(&time),
-				   json_tok_full(buf, &time));
-		}
-
-		if (restime <= now - cinfo->subsystem_age[subsys]) {
-			struct out_req *req;
-			const jsmntok_t *inchan, *inid;
-
-			inchan = json_get_member(buf, t, "in_channel");
-			inid = json_get_member(buf, t, "in_htlc_id");
-
-			req = del_request_start("delforward", cinfo, subsys);
-			json_add_tok(req->js, "in_channel", inchan, buf);
-			/* This can be missing if it was a forwards record from an old
-			 * closed channel in version <= 0.12.1.  This is a special value
-			 * but we will delete them *all*, resulting in some failures! */
-#ifdef COMPAT_V0121
-			if (!inid)
-				json_add_u64(req->js, "in_htlc_id", -1ULL);
-			else
-#endif
-				json_add_tok(req->js, "in_htlc_id", inid, buf);
-			json_add_tok(req->js, "status", status, buf);
-			send_outreq(plugin, req);
-		}
-	}
+	cinfo->counted_uncleaned = true;
 
-	return clean_finished_one(cinfo);
-}
+	if (cinfo->subsystem_age[SUCCEEDEDPAYS] != 0
+	    || cinfo->subsystem_age[FAILEDPAYS] != 0)
+		list_request("listsendpays", "payments", cinfo);
 
-static struct command_result *listsendpays_failed(struct command *cmd,
-						  const char *buf,
-						  const jsmntok_t *result,
-						  void *unused)
-{
-	return cmd_failed(cmd, buf, result, "listsendpays");
-}
+	if (cinfo->subsystem_age[EXPIREDINVOICES] != 0
+	    || cinfo->subsystem_age[PAIDINVOICES] != 0)
+		list_request("listinvoices", "invoices", cinfo);
 
-static struct command_result *listinvoices_failed(struct command *cmd,
-						  const char *buf,
-						  const jsmntok_t *result,
-						  void *unused)
-{
-	return cmd_failed(cmd, buf, result, "listinvoices");
-}
+	if (cinfo->subsystem_age[SUCCEEDEDFORWARDS] != 0
+	    || cinfo->subsystem_age[FAILEDFORWARDS] != 0)
+		list_request("listforwards", "forwards", cinfo);
 
-static struct command_result *listforwards_failed(struct command *cmd,
-						  const char *buf,
-						  const jsmntok_t *result,
-						  void *unused)
-{
-	return cmd_failed(cmd, buf, result, "listforwards");
+	if (cinfo->cleanup_reqs_remaining)
+		return command_still_pending(cinfo->cmd);
+	return clean_finished(cinfo);
 }
 
 static struct command_result *do_clean(struct clean_info *cinfo)
 {
-	struct out_req *req;
-
 	cinfo->cleanup_reqs_remaining = 0;
 	cinfo->num_uncleaned = 0;
+	cinfo->counted_uncleaned = false;
 	memset(cinfo->num_cleaned, 0, sizeof(cinfo->num_cleaned));
 
-	if (cinfo->subsystem_age[SUCCEEDEDPAYS] != 0
-	    || cinfo->subsystem_age[FAILEDPAYS] != 0) {
-		req = jsonrpc_request_start(plugin, NULL, "listsendpays",
-					    listsendpays_done, listsendpays_failed,
-					    cinfo);
-		send_outreq(plugin, req);
-		cinfo->cleanup_reqs_remaining++;
-	}
-
-	if (cinfo->subsystem_age[EXPIREDINVOICES] != 0
-	    || cinfo->subsystem_age[PAIDINVOICES] != 0) {
-		req = jsonrpc_request_start(plugin, NULL, "listinvoices",
-					    listinvoices_done, listinvoices_failed,
-					    cinfo);
-		send_outreq(plugin, req);
-		cinfo->cleanup_reqs_remaining++;
-	}
-
-	if (cinfo->subsystem_age[SUCCEEDEDFORWARDS] != 0
-	    || cinfo->subsystem_age[FAILEDFORWARDS] != 0) {
-		req = jsonrpc_request_start(plugin, NULL, "listforwards",
-					    listforwards_done, listforwards_failed,
-					    cinfo);
-		send_outreq(plugin, req);
-		cinfo->cleanup_reqs_remaining++;
+	if (cinfo->subsystem_age[SUCCEEDEDPAYS] != 0)
+		del_request("delpays", cinfo, SUCCEEDEDPAYS, "complete");
+	if (cinfo->subsystem_age[FAILEDPAYS] != 0)
+		del_request("delpays", cinfo, FAILEDPAYS, "failed");
+
+	if (cinfo->subsystem_age[PAIDINVOICES] != 0)
+		del_request("delinvoices", cinfo, PAIDINVOICES, "paid");
+	if (cinfo->subsystem_age[EXPIREDINVOICES] != 0)
+		del_request("delinvoices", cinfo, EXPIREDINVOICES, "expired");
+
+	if (cinfo->subsystem_age[SUCCEEDEDFORWARDS] != 0)
+		del_request("delforwards", cinfo, SUCCEEDEDFORWARDS, "settled");
+	if (cinfo->subsystem_age[FAILEDFORWARDS] != 0) {
+		del_request("delforwards", cinfo, FAILEDFORWARDS, "failed");
+		del_request("delforwards", cinfo, FAILEDFORWARDS, "local_failed");
 	}
 
 	if (cinfo->cleanup_reqs_remaining)
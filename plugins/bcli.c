@@ -585,6 +585,20 @@ static struct command_result *process_rawblock(struct bitcoin_cli *bcli)
 	strip_trailing_whitespace(bcli->output, bcli->output_bytes);
 	stash->block_hex = tal_steal(stash, bcli->output);
 
+	/* Blocks are big: if lightningd can take raw bytes, save it
+	 * (and the JSON parser) from wading through megabytes of hex. */
+	if (command_attachments_ok(bcli->cmd)) {
+		u8 *block = tal_hexdata(NULL, stash->block_hex,
+					strlen(stash->block_hex));
+		if (!block)
+			return command_err_bcli_badjson(bcli, "bad block hex");
+
+		response = jsonrpc_stream_success(bcli->cmd);
+		json_add_string(response, "blockhash", stash->block_hash);
+		return command_finished_with_attachment(bcli->cmd, response,
+							take(block));
+	}
+
 	response = jsonrpc_stream_success(bcli->cmd);
 	json_add_string(response, "blockhash", stash->block_hash);
 	json_add_string(response, "block", stash->block_hex);
@@ -1006,18 +1006,26 @@ payment_listpeerchannels_success(struct command *cmd,
 	return payment_getroute(p);
 }
 
-static struct command_result *payment_getlocalmods(struct payment *p)
+/* Our copy of listpeerchannels, shared by all payments */
+static struct channel_mirror *local_channels;
+
+static struct channel_mirror *get_local_channels(struct plugin *plugin)
 {
-	struct out_req *req;
+	if (!local_channels)
+		local_channels = new_channel_mirror(plugin);
+	return local_channels;
+}
 
+static struct command_result *payment_getlocalmods(struct payment *p)
+{
 	/* Don't call listpeerchannels if we already have mods */
 	if (p->mods)
 		return payment_getroute(p);
 
-	req = jsonrpc_request_start(p->plugin, NULL, "listpeerchannels",
-				    &payment_listpeerchannels_success,
-				    &payment_rpc_failure, p);
-	return send_outreq(p->plugin, req);
+	return channel_mirror_refresh(p->plugin, NULL,
+				      get_local_channels(p->plugin),
+				      &payment_listpeerchannels_success,
+				      &payment_rpc_failure, p);
 }
 
 static struct payment_result *tal_sendpay_result_from_json(const tal_t *ctx,
@@ -2562,7 +2570,6 @@ local_channel_hints_listpeerchannels(struct command *cmd, const char *buffer,
 
 static void local_channel_hints_cb(void *d UNUSED, struct payment *p)
 {
-	struct out_req *req;
 	/* If we are not the root we don't look up the channel balances since
 	 * it is unlikely that the capacities have changed much since the root
 	 * payment looked at them. We also only call `listpeers` when the
@@ -2571,10 +2578,10 @@ static void local_channel_hints_cb(void *d UNUSED, struct payment *p)
 	if (p->parent != NULL || p->step != PAYMENT_STEP_INITIALIZED)
 		return payment_continue(p);
 
-	req = jsonrpc_request_start(p->plugin, NULL, "listpeerchannels",
-				    local_channel_hints_listpeerchannels,
-				    local_channel_hints_listpeerchannels, p);
-	send_outreq(p->plugin, req);
+	channel_mirror_refresh(p->plugin, NULL,
+			       get_local_channels(p->plugin),
+			       local_channel_hints_listpeerchannels,
+			       local_channel_hints_listpeerchannels, p);
 }
 
 REGISTER_PAYMENT_MODIFIER(local_channel_hints, void *, NULL, local_channel_hints_cb);
@@ -2,6 +2,7 @@
 #include <bitcoin/chainparams.h>
 #include <bitcoin/privkey.h>
 #include <ccan/io/io.h>
+#include <ccan/io/io_plan.h>
 #include <ccan/json_out/json_out.h>
 #include <ccan/read_write_all/read_write_all.h>
 #include <ccan/tal/path/path.h>
@@ -19,9 +20,12 @@
 #include <plugins/libplugin.h>
 #include <stdio.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 
 #define READ_CHUNKSIZE 4096
+/* Most requests we hand to a single writev() */
+#define RPC_WRITE_IOV_MAX 64
 
 struct plugin_timer {
 	struct timer timer;
@@ -76,6 +80,9 @@ struct plugin {
 	/* Is this command overriding global deprecated_ok? */
 	bool *deprecated_ok_override;
 
+	/* Does lightningd accept binary attachments on our responses? */
+	bool attachments;
+
 	/* to append to all our command ids */
 	const char *id;
 
@@ -379,7 +386,9 @@ static struct json_stream *jsonrpc_stream_start(struct command *cmd)
 
 	json_object_start(js, NULL);
 	json_add_string(js, "jsonrpc", "2.0");
-	json_add_id(js, cmd->id);
+	/* Observed hooks come as notifications, with no id */
+	if (cmd->id)
+		json_add_id(js, cmd->id);
 
 	return js;
 }
@@ -424,7 +433,9 @@ static struct command_result *command_complete(struct command *cmd,
 	/* Global object */
 	json_object_end(result);
 	json_stream_close(result, cmd);
-	ld_send(cmd->plugin, result);
+	/* Nobody wants the answer to a notification (e.g. observed hook) */
+	if (cmd->id)
+		ld_send(cmd->plugin, result);
 	tal_free(cmd);
 
 	return &complete;
@@ -447,6 +458,43 @@ struct command_result *command_finished(struct command *cmd,
 	return command_complete(cmd, response);
 }
 
+bool command_attachments_ok(const struct command *cmd)
+{
+	return cmd->plugin->attachments;
+}
+
+struct command_result *command_finished_with_attachment(struct command *cmd,
+							struct json_stream *response,
+							const u8 *attachment TAKES)
+{
+	assert(command_attachments_ok(cmd));
+
+	/* Detach filter before it complains about closing object it never saw */
+	if (cmd->filter) {
+		const char *err = json_stream_detach_filter(tmpctx, response);
+		if (err)
+			json_add_string(response, "warning_parameter_filter",
+					err);
+	}
+
+	/* "result" object */
+	json_object_end(response);
+
+	/* The raw bytes go straight after the global object */
+	json_add_u64(response, "attachment_length", tal_bytelen(attachment));
+	json_object_end(response);
+	json_stream_append(response, (const char *)attachment,
+			   tal_bytelen(attachment));
+	if (taken(attachment))
+		tal_free(attachment);
+
+	json_stream_close(response, cmd);
+	ld_send(cmd->plugin, response);
+	tal_free(cmd);
+
+	return &complete;
+}
+
 struct command_result *WARN_UNUSED_RESULT
 command_still_pending(struct command *cmd)
 {
@@ -946,6 +994,334 @@ struct command_result *jsonrpc_get_datastore_(struct plugin *plugin,
 	return send_outreq(plugin, req);
 }
 
+struct channel_mirror {
+	bool loaded;
+	u64 created_index, updated_index, deleted_index;
+	/* JSON object for each channel, by created_index */
+	UINTMAP(char *) channels;
+	/* JSON objects for channels still being opened, which have no
+	 * created_index (so we reload everything while there are any) */
+	char **unindexed;
+	/* The whole {"channels":[...]} we last handed out, and its tokens:
+	 * NULL if it needs rebuilding. */
+	char *json;
+	jsmntok_t *toks;
+};
+
+struct channel_mirror_req {
+	struct plugin *plugin;
+	struct channel_mirror *mirror;
+	/* Requests still outstanding: we send them all at once. */
+	size_t pending;
+	/* Are we doing a full listing, and have we found we need one? */
+	bool full, need_full;
+	/* Have we called errcb already? */
+	bool failed;
+	struct command_result *(*cb)(struct command *command,
+				     const char *buf,
+				     const jsmntok_t *result,
+				     void *arg);
+	struct command_result *(*errcb)(struct command *command,
+					const char *buf,
+					const jsmntok_t *result,
+					void *arg);
+	void *arg;
+};
+
+static void destroy_channel_mirror(struct channel_mirror *mirror)
+{
+	uintmap_clear(&mirror->channels);
+}
+
+static void channel_mirror_clear(struct channel_mirror *mirror)
+{
+	char *chan;
+	intmap_index_t idx;
+
+	for (chan = uintmap_first(&mirror->channels, &idx);
+	     chan;
+	     chan = uintmap_after(&mirror->channels, &idx))
+		tal_free(chan);
+	uintmap_clear(&mirror->channels);
+	tal_free(mirror->unindexed);
+	mirror->unindexed = tal_arr(mirror, char *, 0);
+	mirror->created_index = mirror->updated_index = 0;
+	mirror->json = tal_free(mirror->json);
+}
+
+struct channel_mirror *new_channel_mirror(const tal_t *ctx)
+{
+	struct channel_mirror *mirror = tal(ctx, struct channel_mirror);
+
+	mirror->loaded = false;
+	mirror->created_index = mirror->updated_index = 0;
+	mirror->deleted_index = 0;
+	uintmap_init(&mirror->channels);
+	mirror->unindexed = tal_arr(mirror, char *, 0);
+	mirror->json = NULL;
+	mirror->toks = NULL;
+	tal_add_destructor(mirror, destroy_channel_mirror);
+	return mirror;
+}
+
+/* Returns the highest updated_index we absorbed (or 0) */
+static u64 channel_mirror_absorb(struct channel_mirror *mirror,
+				 const char *buf,
+				 const jsmntok_t *result)
+{
+	const jsmntok_t *channels, *t;
+	size_t i;
+	u64 max_updated = 0;
+
+	channels = json_get_member(buf, result, "channels");
+	json_for_each_arr(i, t, channels) {
+		const jsmntok_t *idxtok;
+		u64 created_index, updated_index;
+		char *old, *chan;
+
+		chan = tal_strndup(mirror, json_tok_full(buf, t),
+				   json_tok_full_len(t));
+		/* Something changed, so we need to rebuild the result. */
+		mirror->json = tal_free(mirror->json);
+
+		/* Uncommitted channels have no index: we can't track those,
+		 * but they only appear in full listings. */
+		idxtok = json_get_member(buf, t, "created_index");
+		if (!idxtok || !json_to_u64(buf, idxtok, &created_index)) {
+			tal_arr_expand(&mirror->unindexed, chan);
+			continue;
+		}
+
+		idxtok = json_get_member(buf, t, "updated_index");
+		if (idxtok && json_to_u64(buf, idxtok, &updated_index)
+		    && updated_index > max_updated)
+			max_updated = updated_index;
+
+		if (created_index > mirror->created_index)
+			mirror->created_index = created_index;
+
+		old = uintmap_del(&mirror->channels, created_index);
+		tal_free(old);
+		uintmap_add(&mirror->channels, created_index, chan);
+	}
+	return max_updated;
+}
+
+static struct command_result *channel_mirror_done(struct command *cmd,
+						  struct channel_mirror_req *mreq)
+{
+	struct channel_mirror *mirror = mreq->mirror;
+	struct command_result *(*cb)(struct command *command,
+				     const char *buf,
+				     const jsmntok_t *result,
+				     void *arg) = mreq->cb;
+	void *arg = mreq->arg;
+
+	/* Usually nothing changed, and we can reuse the last one. */
+	if (!mirror->json) {
+		const char *sep = "";
+		char *chan;
+		intmap_index_t idx;
+
+		mirror->json = tal_strdup(mirror, "{\"channels\":[");
+		for (chan = uintmap_first(&mirror->channels, &idx);
+		     chan;
+		     chan = uintmap_after(&mirror->channels, &idx)) {
+			tal_append_fmt(&mirror->json, "%s%s", sep, chan);
+			sep = ",";
+		}
+		for (size_t i = 0; i < tal_count(mirror->unindexed); i++) {
+			tal_append_fmt(&mirror->json, "%s%s",
+				       sep, mirror->unindexed[i]);
+			sep = ",";
+		}
+		tal_append_fmt(&mirror->json, "]}");
+		mirror->toks = json_parse_simple(mirror->json, mirror->json,
+						 strlen(mirror->json));
+	}
+
+	tal_free(mreq);
+	return cb(cmd, mirror->json, mirror->toks, arg);
+}
+
+static struct command_result *channel_mirror_full_done(struct command *cmd,
+						       const char *buf,
+						       const jsmntok_t *result,
+						       struct channel_mirror_req *mreq);
+static struct command_result *channel_mirror_err(struct command *cmd,
+						 const char *buf,
+						 const jsmntok_t *error,
+						 struct channel_mirror_req *mreq);
+
+/* Called as each response comes in: once they all have, we're done (unless
+ * we found we need to reload everything). */
+static struct command_result *channel_mirror_next(struct command *cmd,
+						  struct channel_mirror_req *mreq)
+{
+	struct out_req *req;
+
+	if (--mreq->pending != 0)
+		return command_still_pending(cmd);
+
+	if (mreq->failed) {
+		tal_free(mreq);
+		return command_still_pending(cmd);
+	}
+
+	if (!mreq->need_full)
+		return channel_mirror_done(cmd, mreq);
+
+	mreq->full = true;
+	mreq->need_full = false;
+	mreq->pending = 1;
+	req = jsonrpc_request_start(mreq->plugin, cmd, "listpeerchannels",
+				    channel_mirror_full_done,
+				    channel_mirror_err, mreq);
+	return send_outreq(mreq->plugin, req);
+}
+
+static struct command_result *channel_mirror_err(struct command *cmd,
+						 const char *buf,
+						 const jsmntok_t *error,
+						 struct channel_mirror_req *mreq)
+{
+	struct command_result *res;
+
+	/* Only tell them once, then wait for the rest to come back. */
+	if (mreq->failed)
+		return channel_mirror_next(cmd, mreq);
+	mreq->failed = true;
+
+	res = mreq->errcb(cmd, buf, error, mreq->arg);
+	if (--mreq->pending == 0)
+		tal_free(mreq);
+	return res;
+}
+
+static struct command_result *channel_mirror_full_done(struct command *cmd,
+						       const char *buf,
+						       const jsmntok_t *result,
+						       struct channel_mirror_req *mreq)
+{
+	struct channel_mirror *mirror = mreq->mirror;
+	u64 max_updated;
+
+	if (!mreq->failed) {
+		channel_mirror_clear(mirror);
+		max_updated = channel_mirror_absorb(mirror, buf, result);
+		mirror->updated_index = max_updated;
+		mirror->loaded = true;
+	}
+	return channel_mirror_next(cmd, mreq);
+}
+
+static struct command_result *channel_mirror_delta_done(struct command *cmd,
+							const char *buf,
+							const jsmntok_t *result,
+							struct channel_mirror_req *mreq)
+{
+	struct channel_mirror *mirror = mreq->mirror;
+	u64 max_updated;
+
+	/* New channels may already have updated_index, but we still ask for
+	 * everything past what we've seen, so that's harmless. */
+	if (!mreq->failed) {
+		max_updated = channel_mirror_absorb(mirror, buf, result);
+		if (max_updated > mirror->updated_index)
+			mirror->updated_index = max_updated;
+	}
+	return channel_mirror_next(cmd, mreq);
+}
+
+static struct command_result *channel_mirror_wait_done(struct command *cmd,
+						       const char *buf,
+						       const jsmntok_t *result,
+						       struct channel_mirror_req *mreq)
+{
+	struct channel_mirror *mirror = mreq->mirror;
+	const jsmntok_t *deltok;
+	u64 deleted_index;
+
+	deltok = json_get_member(buf, result, "deleted");
+	if (!deltok || !json_to_u64(buf, deltok, &deleted_index))
+		plugin_err(mreq->plugin, "Bad wait response: %.*s",
+			   json_tok_full_len(result),
+			   json_tok_full(buf, result));
+
+	/* We can't tell *which* channel was deleted, so reload them all. */
+	if (deleted_index != mirror->deleted_index) {
+		mirror->deleted_index = deleted_index;
+		if (!mreq->full)
+			mreq->need_full = true;
+	}
+	return channel_mirror_next(cmd, mreq);
+}
+
+static void channel_mirror_delta(struct command *cmd,
+				 struct channel_mirror_req *mreq,
+				 const char *indexname, u64 start)
+{
+	struct out_req *req;
+
+	req = jsonrpc_request_start(mreq->plugin, cmd, "listpeerchannels",
+				    channel_mirror_delta_done,
+				    channel_mirror_err, mreq);
+	json_add_string(req->js, "index", indexname);
+	json_add_u64(req->js, "start", start);
+	send_outreq(mreq->plugin, req);
+}
+
+struct command_result *channel_mirror_refresh_(struct plugin *plugin,
+					       struct command *cmd,
+					       struct channel_mirror *mirror,
+					       struct command_result *(*cb)(struct command *command,
+									    const char *buf,
+									    const jsmntok_t *result,
+									    void *arg),
+					       struct command_result *(*errcb)(struct command *command,
+									       const char *buf,
+									       const jsmntok_t *result,
+									       void *arg),
+					       void *arg)
+{
+	struct out_req *req;
+	struct channel_mirror_req *mreq = tal(mirror, struct channel_mirror_req);
+
+	mreq->plugin = plugin;
+	mreq->mirror = mirror;
+	mreq->cb = cb;
+	mreq->errcb = errcb;
+	mreq->arg = arg;
+	mreq->need_full = false;
+	mreq->failed = false;
+	/* Channels still opening have no index to ask by. */
+	mreq->full = !mirror->loaded || tal_count(mirror->unindexed) != 0;
+
+	/* These all go out (and are answered) together, in order, so this
+	 * costs a single round trip unless something was deleted. */
+	mreq->pending = mreq->full ? 2 : 3;
+
+	/* nextvalue 0 means this returns immediately */
+	req = jsonrpc_request_start(plugin, cmd, "wait",
+				    channel_mirror_wait_done,
+				    channel_mirror_err, mreq);
+	json_add_string(req->js, "subsystem", "channels");
+	json_add_string(req->js, "indexname", "deleted");
+	json_add_u64(req->js, "nextvalue", 0);
+	send_outreq(plugin, req);
+
+	if (mreq->full) {
+		req = jsonrpc_request_start(plugin, cmd, "listpeerchannels",
+					    channel_mirror_full_done,
+					    channel_mirror_err, mreq);
+		return send_outreq(plugin, req);
+	}
+
+	channel_mirror_delta(cmd, mreq, "created", mirror->created_index + 1);
+	channel_mirror_delta(cmd, mreq, "updated", mirror->updated_index + 1);
+	return command_still_pending(cmd);
+}
+
 static void handle_rpc_reply(struct plugin *plugin, const jsmntok_t *toks)
 {
 	const jsmntok_t *idtok, *contenttok;
@@ -1044,6 +1420,12 @@ handle_getmanifest(struct command *getmanifest_cmd,
 			   json_tok_full(buf, getmanifest_params));
 	}
 
+	/* Older lightningd won't offer this */
+	if (json_scan(tmpctx, buf, getmanifest_params,
+		      "{attachments:%}",
+		      JSON_SCAN(json_to_bool, &p->attachments)) != NULL)
+		p->attachments = false;
+
 	json_array_start(params, "options");
 	for (size_t i = 0; i < tal_count(p->opts); i++) {
 		if (p->opts[i].dev_only && !p->developer)
@@ -1109,6 +1491,15 @@ handle_getmanifest(struct command *getmanifest_cmd,
 						p->hook_subs[i].after[j]);
 			json_array_end(params);
 		}
+		if (p->hook_subs[i].observe)
+			json_add_bool(params, "observe", true);
+		if (p->hook_subs[i].strfilters) {
+			json_array_start(params, "filters");
+			for (size_t j = 0; p->hook_subs[i].strfilters[j]; j++)
+				json_add_string(params, NULL,
+						p->hook_subs[i].strfilters[j]);
+			json_array_end(params);
+		}
 		json_object_end(params);
 	}
 	json_array_end(params);
@@ -1128,6 +1519,8 @@ handle_getmanifest(struct command *getmanifest_cmd,
 	json_add_bool(params, "dynamic", p->restartability == PLUGIN_RESTARTABLE);
 	json_add_bool(params, "nonnumericids", true);
 	json_add_bool(params, "cancheck", true);
+	if (p->attachments)
+		json_add_bool(params, "attachments", true);
 
 	json_array_start(params, "notifications");
 	for (size_t i = 0; p->notif_topics && i < p->num_notif_topics; i++) {
@@ -1215,31 +1608,66 @@ static struct io_plan *rpc_conn_read_response(struct io_conn *conn,
 			       rpc_conn_read_response, plugin);
 }
 
-static struct io_plan *rpc_conn_write_request(struct io_conn *conn,
-					      struct plugin *plugin);
+/* Plugins often fire off many small requests at once: we send everything
+ * queued in a single writev(), straight from each request's json_out, so
+ * lightningd reads them together (and, with rpc_enable_batching(), commits
+ * them in one db transaction).  ccan/io has no vectored write, so this is
+ * our own plan: u1 is the plugin, u2 how much of the first one is written. */
+static int do_write_rpc_requests(int fd, struct io_plan_arg *arg)
+{
+	struct plugin *plugin = arg->u1.vp;
+	struct iovec iov[RPC_WRITE_IOV_MAX];
+	struct jstream *jstr;
+	size_t n = 0, written;
+	ssize_t ret;
+
+	list_for_each(&plugin->rpc_js_list, jstr, list) {
+		size_t len;
+
+		/* send_outreq() closed it, so it's all in jout. */
+		assert(!jstr->js->writer);
+		iov[n].iov_base = (char *)json_out_contents(jstr->js->jout, &len);
+		iov[n].iov_len = len;
+		if (++n == ARRAY_SIZE(iov))
+			break;
+	}
 
-static struct io_plan *
-rpc_stream_complete(struct io_conn *conn, struct json_stream *js,
-		    struct plugin *plugin)
-{
-	struct jstream *jstr = list_pop(&plugin->rpc_js_list, struct jstream, list);
-	assert(jstr);
-	assert(jstr->js == js);
-	tal_free(jstr);
+	iov[0].iov_base = (char *)iov[0].iov_base + arg->u2.s;
+	iov[0].iov_len -= arg->u2.s;
+	ret = writev(fd, iov, n);
+	if (ret < 0)
+		return -1;
+	iov[0].iov_len += arg->u2.s;
+
+	/* Free the ones which are completely written. */
+	written = arg->u2.s + ret;
+	for (size_t i = 0; i < n && written >= iov[i].iov_len; i++) {
+		written -= iov[i].iov_len;
+		tal_free(list_pop(&plugin->rpc_js_list, struct jstream, list));
+	}
+	arg->u2.s = written;
 
-	return rpc_conn_write_request(conn, plugin);
+	/* More may have been queued meanwhile: keep going until empty. */
+	return list_empty(&plugin->rpc_js_list);
 }
 
 static struct io_plan *rpc_conn_write_request(struct io_conn *conn,
 					      struct plugin *plugin)
 {
-	struct jstream *jstr = list_top(&plugin->rpc_js_list, struct jstream, list);
-	if (jstr)
-		return json_stream_output(jstr->js, conn,
-					  rpc_stream_complete, plugin);
+	struct io_plan_arg *arg;
+
+	if (list_empty(&plugin->rpc_js_list))
+		return io_out_wait(conn, plugin->io_rpc_conn,
+				   rpc_conn_write_request, plugin);
 
-	return io_out_wait(conn, plugin->io_rpc_conn,
-			   rpc_conn_write_request, plugin);
+	arg = io_plan_arg(conn, IO_OUT);
+	arg->u1.vp = plugin;
+	arg->u2.s = 0;
+	return io_set_plan(conn, IO_OUT, do_write_rpc_requests,
+			   typesafe_cb_preargs(struct io_plan *, void *,
+					       rpc_conn_write_request, plugin,
+					       struct io_conn *),
+			   plugin);
 }
 
 static struct io_plan *rpc_conn_init(struct io_conn *conn,
@@ -1832,6 +2260,18 @@ static void ld_command_handle(struct plugin *plugin,
 			}
 		}
 
+		/* Observe-only hooks are sent as notifications */
+		for (size_t i = 0; i < plugin->num_hook_subs; i++) {
+			if (plugin->hook_subs[i].observe
+			    && streq(cmd->methodname,
+				     plugin->hook_subs[i].name)) {
+				plugin->hook_subs[i].handle(cmd,
+							    plugin->buffer,
+							    paramstok);
+				return;
+			}
+		}
+
 		/* We subscribe them to this always */
 		if (is_shutdown && plugin->developer)
 			plugin_exit(plugin, 0);
@@ -1980,7 +2420,7 @@ static bool ld_read_json_one(struct plugin *plugin)
 
 	/* Move this object out of the buffer */
 	memmove(plugin->buffer, plugin->buffer + plugin->toks[0].end,
-		tal_count(plugin->buffer) - plugin->toks[0].end);
+		plugin->used - plugin->toks[0].end);
 	plugin->used -= plugin->toks[0].end;
 	toks_reset(plugin->toks);
 	jsmn_init(&plugin->parser);
@@ -2091,6 +2531,7 @@ static struct plugin *new_plugin(const tal_t *ctx,
 	name[path_ext_off(name)] = '\0';
 	p->id = name;
 	p->developer = developer;
+	p->attachments = false;
 	p->deprecated_ok_override = NULL;
 	p->buffer = tal_arr(p, char, 64);
 	list_head_init(&p->js_list);
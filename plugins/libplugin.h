@@ -93,6 +93,11 @@ struct plugin_hook {
 	                                 const jsmntok_t *params);
 	/* If non-NULL, these are NULL-terminated arrays of deps */
 	const char **before, **after;
+	/* If true, we only watch: lightningd doesn't wait for our answer */
+	bool observe;
+	/* If non-NULL, NULL-terminated array of filters (e.g. method names
+	 * for rpc_command): we're only called for those. */
+	const char **strfilters;
 };
 
 /* Return the feature set of the current lightning node */
@@ -238,12 +243,55 @@ struct command_result *jsonrpc_get_datastore_(struct plugin *plugin,
 						   const u8 *val),	\
 			       (arg))
 
+/* A local copy of listpeerchannels, kept up to date using the "channels"
+ * wait indexes, so we don't fetch every channel on every call. */
+struct channel_mirror *new_channel_mirror(const tal_t *ctx);
+
+/* Bring @mirror up to date, then call @cb with a listpeerchannels-style
+ * result ({"channels":[...]}).  @errcb gets any RPC error. */
+struct command_result *channel_mirror_refresh_(struct plugin *plugin,
+					       struct command *cmd,
+					       struct channel_mirror *mirror,
+					       struct command_result *(*cb)(struct command *command,
+									    const char *buf,
+									    const jsmntok_t *result,
+									    void *arg),
+					       struct command_result *(*errcb)(struct command *command,
+									       const char *buf,
+									       const jsmntok_t *result,
+									       void *arg),
+					       void *arg);
+
+#define channel_mirror_refresh(plugin, cmd, mirror, cb, errcb, arg)	\
+	channel_mirror_refresh_((plugin), (cmd), (mirror),		\
+				typesafe_cb_preargs(struct command_result *, void *, \
+						    (cb), (arg),	\
+						    struct command *command, \
+						    const char *buf,	\
+						    const jsmntok_t *result), \
+				typesafe_cb_preargs(struct command_result *, void *, \
+						    (errcb), (arg),	\
+						    struct command *command, \
+						    const char *buf,	\
+						    const jsmntok_t *result), \
+				(arg))
 
 /* This command is finished, here's the response (the content of the
  * "result" or "error" field) */
 WARN_UNUSED_RESULT
 struct command_result *command_finished(struct command *cmd, struct json_stream *response);
 
+/* Does lightningd accept command_finished_with_attachment()? */
+bool command_attachments_ok(const struct command *cmd);
+
+/* Like command_finished, but @attachment is sent as raw bytes after the
+ * response, rather than as (say) a hex string in it.  Only valid if
+ * command_attachments_ok(). */
+WARN_UNUSED_RESULT
+struct command_result *command_finished_with_attachment(struct command *cmd,
+							struct json_stream *response,
+							const u8 *attachment TAKES);
+
 /* Helper for a command that'll be finished in a callback. */
 WARN_UNUSED_RESULT
 struct command_result *command_still_pending(struct command *cmd);
@@ -93,6 +93,8 @@ struct db_query {
 	sqlite3_stmt *stmt;
 	struct table_desc **tables;
 	const char *authfail;
+	/* For incremental refresh: the created_index we asked to start at */
+	u64 created_start;
 };
 
 struct table_desc {
@@ -113,6 +115,9 @@ struct table_desc {
 	struct command_result *(*refresh)(struct command *cmd,
 					  const struct table_desc *td,
 					  struct db_query *dbq);
+	/* For tables with a wait subsystem, we only refresh changes: */
+	bool loaded;
+	u64 created_index, updated_index, deleted_index;
 };
 static STRMAP(struct table_desc *) tablemap;
 static size_t max_dbmem = 500000000;
@@ -172,6 +177,14 @@ static const struct index indices[] = {
 	},
 };
 
+/* These have a wait subsystem of the same name, so we can refresh
+ * incrementally using created_index and updated_index. */
+static const char *wait_tables[] = {
+	"forwards",
+	"invoices",
+	"sendpays",
+};
+
 static enum fieldtype find_fieldtype(const jsmntok_t *name)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(fieldtypemap); i++) {
@@ -723,6 +736,198 @@ static struct command_result *default_refresh(struct command *cmd,
 	return send_outreq(cmd->plugin, req);
 }
 
+static bool has_wait_indexes(const char *tablename)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(wait_tables); i++) {
+		if (streq(tablename, wait_tables[i]))
+			return true;
+	}
+	return false;
+}
+
+static u64 max_index(struct command *cmd,
+		     const struct table_desc *td,
+		     const char *colname)
+{
+	sqlite3_stmt *stmt;
+	const char *query;
+	u64 max = 0;
+	int err;
+
+	query = tal_fmt(tmpctx, "SELECT MAX(%s) FROM %s;", colname, td->name);
+	err = sqlite3_prepare_v2(db, query, -1, &stmt, NULL);
+	if (err != SQLITE_OK)
+		plugin_err(cmd->plugin, "preparing '%s' failed: %s",
+			   query, sqlite3_errmsg(db));
+
+	/* MAX() of an empty table (or all-NULL column) is NULL */
+	if (sqlite3_step(stmt) == SQLITE_ROW
+	    && sqlite3_column_type(stmt, 0) != SQLITE_NULL)
+		max = sqlite3_column_int64(stmt, 0);
+	sqlite3_finalize(stmt);
+	return max;
+}
+
+static void delete_by_created_index(struct command *cmd,
+				    const struct table_desc *td,
+				    const char *op, u64 created_index)
+{
+	int err;
+	char *errmsg;
+
+	/* Sub-tables are cleaned up by ON DELETE CASCADE */
+	err = sqlite3_exec(db,
+			   tal_fmt(tmpctx,
+				   "DELETE FROM %s WHERE created_index %s %"PRIu64,
+				   td->name, op, created_index),
+			   NULL, NULL, &errmsg);
+	if (err != SQLITE_OK)
+		plugin_err(cmd->plugin, "Could not delete from %s: %s",
+			   td->name, errmsg);
+}
+
+static struct command_result *indexed_list_full_done(struct command *cmd,
+						     const char *buf,
+						     const jsmntok_t *result,
+						     struct db_query *dbq)
+{
+	struct table_desc *td = dbq->tables[0];
+	struct command_result *ret;
+	int err;
+	char *errmsg;
+
+	err = sqlite3_exec(db, tal_fmt(tmpctx, "DELETE FROM %s;", td->name),
+			   NULL, NULL, &errmsg);
+	if (err != SQLITE_OK) {
+		return command_fail(cmd, LIGHTNINGD, "cleaning '%s' failed: %s",
+				    td->name, errmsg);
+	}
+
+	ret = process_json_result(cmd, buf, result, td);
+	if (ret)
+		return ret;
+
+	td->created_index = max_index(cmd, td, "created_index");
+	td->updated_index = max_index(cmd, td, "updated_index");
+	td->loaded = true;
+	return one_refresh_done(cmd, dbq);
+}
+
+static struct command_result *indexed_list_updated_done(struct command *cmd,
+							const char *buf,
+							const jsmntok_t *result,
+							struct db_query *dbq)
+{
+	struct table_desc *td = dbq->tables[0];
+	const jsmntok_t *arr, *t;
+	struct command_result *ret;
+	size_t i;
+
+	/* Replace the old versions of these entries. */
+	arr = json_get_member(buf, result, td->arrname);
+	json_for_each_arr(i, t, arr) {
+		u64 created_index;
+		const jsmntok_t *idx = json_get_member(buf, t, "created_index");
+		if (!idx || !json_to_u64(buf, idx, &created_index))
+			plugin_err(cmd->plugin, "%s entry without created_index: %.*s",
+				   td->cmdname,
+				   json_tok_full_len(t), json_tok_full(buf, t));
+		delete_by_created_index(cmd, td, "=", created_index);
+	}
+
+	ret = process_json_list(cmd, buf, arr, NULL, td);
+	if (ret)
+		return ret;
+
+	td->updated_index = max_index(cmd, td, "updated_index");
+	return one_refresh_done(cmd, dbq);
+}
+
+static struct command_result *indexed_list_created_done(struct command *cmd,
+							const char *buf,
+							const jsmntok_t *result,
+							struct db_query *dbq)
+{
+	struct table_desc *td = dbq->tables[0];
+	struct command_result *ret;
+	struct out_req *req;
+
+	/* An earlier updated listing may already have given us some of
+	 * these (if they were updated right after creation), as may
+	 * another query's refresh which overlapped with ours. */
+	delete_by_created_index(cmd, td, ">=", dbq->created_start);
+	ret = process_json_result(cmd, buf, result, td);
+	if (ret)
+		return ret;
+	td->created_index = max_index(cmd, td, "created_index");
+
+	/* Now, what changed? */
+	req = jsonrpc_request_start(cmd->plugin, cmd, td->cmdname,
+				    indexed_list_updated_done, forward_error,
+				    dbq);
+	json_add_string(req->js, "index", "updated");
+	json_add_u64(req->js, "start", td->updated_index + 1);
+	return send_outreq(cmd->plugin, req);
+}
+
+static struct command_result *wait_deleted_done(struct command *cmd,
+						const char *buf,
+						const jsmntok_t *result,
+						struct db_query *dbq)
+{
+	struct table_desc *td = dbq->tables[0];
+	const jsmntok_t *deltok;
+	u64 deleted_index;
+	struct out_req *req;
+
+	deltok = json_get_member(buf, result, "deleted");
+	if (!deltok || !json_to_u64(buf, deltok, &deleted_index))
+		plugin_err(cmd->plugin, "Bad wait response: %.*s",
+			   json_tok_full_len(result),
+			   json_tok_full(buf, result));
+
+	/* We can't tell *what* was deleted, so if anything was, reload
+	 * everything. */
+	if (!td->loaded || deleted_index != td->deleted_index) {
+		plugin_log(cmd->plugin, LOG_DBG, "Full refresh of %s",
+			   td->name);
+		td->loaded = false;
+		td->deleted_index = deleted_index;
+		req = jsonrpc_request_start(cmd->plugin, cmd, td->cmdname,
+					    indexed_list_full_done,
+					    forward_error,
+					    dbq);
+		return send_outreq(cmd->plugin, req);
+	}
+
+	plugin_log(cmd->plugin, LOG_DBG,
+		   "Refreshing %s created > %"PRIu64", updated > %"PRIu64,
+		   td->name, td->created_index, td->updated_index);
+	dbq->created_start = td->created_index + 1;
+	req = jsonrpc_request_start(cmd->plugin, cmd, td->cmdname,
+				    indexed_list_created_done, forward_error,
+				    dbq);
+	json_add_string(req->js, "index", "created");
+	json_add_u64(req->js, "start", dbq->created_start);
+	return send_outreq(cmd->plugin, req);
+}
+
+static struct command_result *indexed_refresh(struct command *cmd,
+					      const struct table_desc *td,
+					      struct db_query *dbq)
+{
+	struct out_req *req;
+
+	/* nextvalue 0 means this returns immediately */
+	req = jsonrpc_request_start(cmd->plugin, cmd, "wait",
+				    wait_deleted_done, forward_error,
+				    dbq);
+	json_add_string(req->js, "subsystem", td->name);
+	json_add_string(req->js, "indexname", "deleted");
+	json_add_u64(req->js, "nextvalue", 0);
+	return send_outreq(cmd->plugin, req);
+}
+
 static bool extract_scid(int gosstore_fd, size_t off, u16 type,
 			 struct short_channel_id *scid)
 {
@@ -1320,8 +1525,12 @@ static struct table_desc *new_table_desc(const tal_t *ctx,
 		td->refresh = channels_refresh;
 	else if (streq(td->name, "nodes"))
 		td->refresh = nodes_refresh;
+	else if (!parent && has_wait_indexes(td->name))
+		td->refresh = indexed_refresh;
 	else
 		td->refresh = default_refresh;
+	td->loaded = false;
+	td->created_index = td->updated_index = td->deleted_index = 0;
 
 	/* sub-objects are a JSON thing, not a real table! */
 	if (!td->is_subobject)
@@ -1511,6 +1720,20 @@ static void init_indices(struct plugin *plugin)
 		if (err != SQLITE_OK)
 			plugin_err(plugin, "Failed '%s': %s", cmd, errmsg);
 	}
+
+	/* Incremental refresh replaces entries by created_index */
+	for (size_t i = 0; i < ARRAY_SIZE(wait_tables); i++) {
+		char *errmsg, *cmd;
+		int err;
+
+		cmd = tal_fmt(tmpctx,
+			      "CREATE INDEX %s_created_index_idx"
+			      " ON %s (created_index);",
+			      wait_tables[i], wait_tables[i]);
+		err = sqlite3_exec(db, cmd, NULL, NULL, &errmsg);
+		if (err != SQLITE_OK)
+			plugin_err(plugin, "Failed '%s': %s", cmd, errmsg);
+	}
 }
 
 static void memleak_mark_tablemap(struct plugin *p, struct htable *memtable)
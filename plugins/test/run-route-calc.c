@@ -18,6 +18,20 @@ u8 **blinded_onion_hops(const tal_t *ctx UNNEEDED,
 			struct amount_msat total_amount UNNEEDED,
 			const struct blinded_path *path UNNEEDED)
 { fprintf(stderr, "blinded_onion_hops called!\n"); abort(); }
+/* Generated stub for channel_mirror_refresh_ */
+struct command_result *channel_mirror_refresh_(struct plugin *plugin UNNEEDED,
+					       struct command *cmd UNNEEDED,
+					       struct channel_mirror *mirror UNNEEDED,
+					       struct command_result *(*cb)(struct command *command UNNEEDED,
+									    const char *buf UNNEEDED,
+									    const jsmntok_t *result UNNEEDED,
+									    void *arg) UNNEEDED,
+					       struct command_result *(*errcb)(struct command *command UNNEEDED,
+									       const char *buf UNNEEDED,
+									       const jsmntok_t *result UNNEEDED,
+									       void *arg) UNNEEDED,
+					       void *arg UNNEEDED)
+{ fprintf(stderr, "channel_mirror_refresh_ called!\n"); abort(); }
 /* Generated stub for command_finished */
 struct command_result *command_finished(struct command *cmd UNNEEDED, struct json_stream *response UNNEEDED)
 { fprintf(stderr, "command_finished called!\n"); abort(); }
@@ -246,6 +260,9 @@ struct json_stream *jsonrpc_stream_fail(struct command *cmd UNNEEDED,
 /* Generated stub for jsonrpc_stream_success */
 struct json_stream *jsonrpc_stream_success(struct command *cmd UNNEEDED)
 { fprintf(stderr, "jsonrpc_stream_success called!\n"); abort(); }
+/* Generated stub for new_channel_mirror */
+struct channel_mirror *new_channel_mirror(const tal_t *ctx UNNEEDED)
+{ fprintf(stderr, "new_channel_mirror called!\n"); abort(); }
 /* Generated stub for notleak_ */
 void *notleak_(void *ptr UNNEEDED, bool plus_children UNNEEDED)
 { fprintf(stderr, "notleak_ called!\n"); abort(); }
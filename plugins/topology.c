@@ -227,8 +227,9 @@ static void json_add_halfchan(struct json_stream *response,
 	struct amount_sat capacity;
 	bool local_disable;
 
-	/* These are channel (not per-direction) properties */
-	chanfeatures = gossmap_chan_get_features(tmpctx, gossmap, c);
+	/* These are channel (not per-direction) properties: features are
+	 * only fetched (once) if they're not filtered out. */
+	chanfeatures = NULL;
 	scid = gossmap_chan_scid(gossmap, c);
 	for (size_t i = 0; i < 2; i++)
 		gossmap_node_get_id(gossmap, gossmap_nth_node(gossmap, c, i),
@@ -302,7 +303,13 @@ static void json_add_halfchan(struct json_stream *response,
 				     htlc_minimum_msat);
 		json_add_amount_msat(response, "htlc_maximum_msat",
 				     htlc_maximum_msat);
-		json_add_hex_talarr(response, "features", chanfeatures);
+		if (json_stream_wants(response, "features")) {
+			if (!chanfeatures)
+				chanfeatures = gossmap_chan_get_features(tmpctx,
+									 gossmap,
+									 c);
+			json_add_hex_talarr(response, "features", chanfeatures);
+		}
 		json_object_end(response);
 	}
 }
@@ -487,6 +494,16 @@ static void json_add_node(struct json_stream *js,
 	json_object_start(js, NULL);
 	gossmap_node_get_id(gossmap, n, &node_id);
 	json_add_node_id(js, "nodeid", &node_id);
+
+	/* Don't fetch and parse the announcement if nothing from it is wanted */
+	if (!json_stream_wants(js, "alias")
+	    && !json_stream_wants(js, "color")
+	    && !json_stream_wants(js, "last_timestamp")
+	    && !json_stream_wants(js, "features")
+	    && !json_stream_wants(js, "addresses")
+	    && !json_stream_wants(js, "option_will_fund"))
+		goto out;
+
 	nannounce = gossmap_node_get_announce(tmpctx, gossmap, n);
 	if (nannounce) {
 		secp256k1_ecdsa_signature signature;
@@ -526,11 +543,13 @@ static void json_add_node(struct json_stream *js,
 		json_add_u64(js, "last_timestamp", timestamp);
 		json_add_hex_talarr(js, "features", features);
 
-		json_array_start(js, "addresses");
-		addrs = fromwire_wireaddr_array(nannounce, addresses);
-		for (size_t i = 0; i < tal_count(addrs); i++)
-			json_add_address(js, NULL, &addrs[i]);
-		json_array_end(js);
+		if (json_stream_wants(js, "addresses")) {
+			json_array_start(js, "addresses");
+			addrs = fromwire_wireaddr_array(nannounce, addresses);
+			for (size_t i = 0; i < tal_count(addrs); i++)
+				json_add_address(js, NULL, &addrs[i]);
+			json_array_end(js);
+		}
 
 		if (na_tlvs->option_will_fund) {
 			json_object_start(js, "option_will_fund");
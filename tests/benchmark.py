@@ -1,9 +1,11 @@
 from concurrent import futures
 from fixtures import *  # noqa: F401,F403
-from time import time
+from pyln.testing.utils import sync_blockheight, wait_for
+from time import sleep, time
 from tqdm import tqdm
 
 
+import os
 import pytest
 import random
 
@@ -52,6 +54,39 @@ def test_single_hop(node_factory, executor):
     print("Done. %d payments performed in %f seconds (%f payments per second)" % (num_payments, diff, num_payments / diff))
 
 
+def test_forward_throughput(node_factory, executor):
+    """Measure how many HTLCs l2 can forward per second"""
+    l1, l2, l3 = node_factory.line_graph(3, fundamount=10**7,
+                                         wait_for_announce=True)
+
+    print("Collecting invoices")
+    fs = []
+    invoices = []
+    for i in tqdm(range(num_payments)):
+        inv = l3.rpc.invoice(1000, 'invoice-%d' % (i), 'desc')
+        invoices.append((inv['payment_hash'], inv['payment_secret']))
+
+    route = l1.rpc.getroute(l3.info['id'], 1000, 1)['route']
+    print("Sending payments")
+    start_time = time()
+
+    def do_pay(i, s):
+        p = l1.rpc.sendpay(route, i, payment_secret=s)
+        r = l1.rpc.waitsendpay(p['payment_hash'])
+        return r
+
+    for i, s in invoices:
+        fs.append(executor.submit(do_pay, i, s))
+
+    for f in tqdm(futures.as_completed(fs), total=len(fs)):
+        f.result()
+
+    diff = time() - start_time
+    forwards = len(l2.rpc.listforwards(status='settled')['forwards'])
+    assert forwards == num_payments
+    print("Done. %d forwards performed in %f seconds (%f forwards per second)" % (forwards, diff, forwards / diff))
+
+
 def test_single_payment(node_factory, benchmark):
     l1, l2 = node_factory.line_graph(2)
 
@@ -72,6 +107,26 @@ def test_forward_payment(node_factory, benchmark):
     benchmark(do_pay, l1, l3)
 
 
+@pytest.mark.parametrize("replica", [False, True])
+def test_forward_payment_replica(node_factory, benchmark, replica):
+    """Forwarding latency with and without a sqlite3 main:backup replica"""
+    if os.getenv('TEST_DB_PROVIDER', 'sqlite3') != 'sqlite3':
+        pytest.skip("Replicas are a sqlite3 feature")
+
+    l1, l2, l3 = node_factory.line_graph(3, wait_for_announce=True)
+    if replica:
+        l2.stop()
+        l2.daemon.opts['wallet'] = "sqlite3://{0}:{0}.bak".format(l2.db.path)
+        l2.start()
+        wait_for(lambda: [c['peer_connected'] for c in l2.rpc.listpeerchannels()['channels']] == [True, True])
+
+    def do_pay(src, dest):
+        invoice = dest.rpc.invoice(1000, 'invoice-{}'.format(random.random()), 'desc')['bolt11']
+        src.rpc.pay(invoice)
+
+    benchmark(do_pay, l1, l3)
+
+
 def test_long_forward_payment(node_factory, benchmark):
     nodes = node_factory.line_graph(21, wait_for_announce=True)
 
@@ -107,3 +162,89 @@ def test_pay(node_factory, benchmark):
 
 def test_start(node_factory, benchmark):
     benchmark(node_factory.get_node)
+
+
+def node_with_channels(node_factory, bitcoind, num_channels):
+    """A node with num_channels channels: past 30, peers get several each"""
+    l1 = node_factory.get_node()
+    peers = node_factory.get_nodes(min(num_channels, 30))
+
+    l1.fundwallet(10**5 * (num_channels + 1))
+    for p in peers:
+        l1.connect(p)
+    # One channel per peer per funding tx, so each round spends the last's change.
+    for done in range(0, num_channels, len(peers)):
+        l1.rpc.multifundchannel([{'id': p.info['id'], 'amount': 10**5}
+                                 for p in peers[:num_channels - done]])
+        bitcoind.generate_block(1, wait_for_mempool=1)
+        sync_blockheight(bitcoind, [l1])
+    bitcoind.generate_block(5)
+    wait_for(lambda: [c['state'] for c in l1.rpc.listpeerchannels()['channels']] == ['CHANNELD_NORMAL'] * num_channels)
+    return l1
+
+
+@pytest.mark.parametrize("num_channels", [1, 10, 30, 300])
+def test_listpeerchannels(node_factory, bitcoind, benchmark, num_channels):
+    """listpeerchannels latency as the number of channels grows"""
+    l1 = node_with_channels(node_factory, bitcoind, num_channels)
+
+    benchmark(l1.rpc.listpeerchannels)
+
+
+@pytest.mark.parametrize("num_channels", [1, 10, 30, 300])
+def test_listpeerchannels_filtered(node_factory, bitcoind, benchmark, num_channels):
+    """listpeerchannels latency when only cheap fields are wanted"""
+    l1 = node_with_channels(node_factory, bitcoind, num_channels)
+
+    benchmark(l1.rpc.call, 'listpeerchannels', {},
+              filter={"channels": [{"peer_id": True, "state": True}]})
+
+
+@pytest.mark.parametrize("filtered", [False, True])
+def test_listchannels(node_factory, benchmark, filtered):
+    """listchannels latency, with and without a filter"""
+    nodes = node_factory.line_graph(10, wait_for_announce=True)
+    l1 = nodes[0]
+    wait_for(lambda: len(l1.rpc.listchannels()['channels']) == 18)
+
+    if filtered:
+        filt = {"channels": [{"short_channel_id": True, "direction": True}]}
+    else:
+        filt = None
+    benchmark(l1.rpc.call, 'listchannels', {}, filter=filt)
+
+
+@pytest.mark.parametrize("count", [10, 100, 1000])
+def test_plugin_rpc_burst(node_factory, benchmark, count):
+    """A C plugin firing off many rpc requests at once"""
+    plugin = os.path.join(os.getcwd(), "tests/plugins/test_libplugin")
+    l1 = node_factory.get_node(options={'plugin': plugin})
+
+    benchmark(l1.rpc.call, 'testrpc-burst', {'count': count})
+
+
+@pytest.mark.parametrize("num_subscribers", [1, 5, 20])
+def test_notification_fanout(node_factory, benchmark, num_subscribers):
+    """Notification throughput as the number of subscribers grows"""
+    l1 = node_factory.get_node()
+    src = os.path.join(os.path.dirname(__file__), "plugins/notify_flood.py")
+    names = []
+    for i in range(num_subscribers):
+        names.append('notify_flood-{}'.format(i))
+        dst = os.path.join(l1.daemon.lightning_dir, names[-1] + '.py')
+        with open(src) as f, open(dst, 'w') as g:
+            g.write(f.read())
+        os.chmod(dst, 0o755)
+        l1.rpc.plugin_start(dst)
+
+    num_notifications = 1000
+    total = [0]
+
+    def flood():
+        total[0] += num_notifications
+        l1.rpc.call('flood-' + names[0], {'count': num_notifications})
+        for n in names:
+            while l1.rpc.call('floodcount-' + n)['received'] < total[0]:
+                sleep(0.01)
+
+    benchmark(flood)
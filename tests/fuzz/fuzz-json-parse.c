@@ -0,0 +1,74 @@
+#include "config.h"
+#include <assert.h>
+#include <common/json_parse_simple.h>
+#include <common/utils.h>
+#include <tests/fuzz/libfuzz.h>
+
+/* lightningd and plugins feed json_parse_input whatever read() gave them,
+ * and resume once more arrives: make sure however the input is split, the
+ * first element comes out exactly as parsing it in one go would give.
+ * The first byte of each input is the split size, not JSON.
+ * common/test/run-json_parse_input benchmarks the same splitting. */
+
+void init(int *argc, char ***argv)
+{
+}
+
+/* Parse @input, @step bytes at a time. */
+static bool parse_in_steps(const tal_t *ctx, const char *input, size_t len,
+			   size_t step, jsmntok_t **toks, bool *complete)
+{
+	jsmn_parser parser;
+	size_t used = 0;
+
+	*toks = toks_alloc(ctx);
+	jsmn_init(&parser);
+	do {
+		used += step;
+		if (used > len)
+			used = len;
+		if (!json_parse_input(&parser, toks, input, used, complete))
+			return false;
+	} while (!*complete && used < len);
+
+	return true;
+}
+
+void run(const uint8_t *data, size_t size)
+{
+	char *input;
+	jsmntok_t *whole, *partial;
+	bool whole_ok, partial_ok, whole_complete, partial_complete;
+	size_t step;
+
+	if (size < 1)
+		return;
+
+	/* First byte decides how finely we split the rest. */
+	step = data[0] + 1;
+	input = to_string(tmpctx, data + 1, size - 1);
+
+	whole_ok = parse_in_steps(tmpctx, input, size - 1, size,
+				  &whole, &whole_complete);
+	partial_ok = parse_in_steps(tmpctx, input, size - 1, step,
+				    &partial, &partial_complete);
+
+	/* Splitting can only hide trailing junk after the first complete
+	 * element, never make the first element itself invalid. */
+	if (!partial_ok)
+		assert(!whole_ok);
+	if (!whole_ok || !whole_complete)
+		goto out;
+
+	assert(partial_ok && partial_complete);
+	assert(tal_count(whole) == tal_count(partial));
+	for (size_t i = 0; i < tal_count(whole); i++) {
+		assert(whole[i].type == partial[i].type);
+		assert(whole[i].start == partial[i].start);
+		assert(whole[i].end == partial[i].end);
+		assert(whole[i].size == partial[i].size);
+	}
+
+out:
+	clean_tmpctx();
+}
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""A Bitcoin backend which sends blocks as attachments, right behind the JSON.
+
+pyln-client doesn't know about attachments, so this speaks raw JSON-RPC.
+"""
+import json
+import os
+import subprocess
+import sys
+
+
+network = os.environ.get("TEST_NETWORK", "regtest")
+cli = "bitcoin-cli" if network == "regtest" else "elements-cli"
+options = {}
+attachments = False
+
+OPTIONS = ["bitcoin-rpcuser", "bitcoin-rpcpassword",
+           "bitcoin-datadir", "bitcoin-rpcport"]
+
+
+def bcli(cmd):
+    ret = subprocess.run([cli,
+                          '-datadir={}'.format(options["bitcoin-datadir"]),
+                          '-rpcuser={}'.format(options["bitcoin-rpcuser"]),
+                          '-rpcpassword={}'.format(options["bitcoin-rpcpassword"]),
+                          '-rpcport={}'.format(options["bitcoin-rpcport"])]
+                         + cmd, stdout=subprocess.PIPE)
+    if ret.returncode != 0:
+        return None
+    return ret.stdout.decode('utf-8')
+
+
+def write(b):
+    sys.stdout.buffer.write(b)
+    sys.stdout.buffer.flush()
+
+
+def respond(reqid, result, attachment=None):
+    resp = {"jsonrpc": "2.0", "id": reqid, "result": result}
+    if attachment is None:
+        write(json.dumps(resp).encode() + b"\n\n")
+        return
+
+    # JSON and attachment in one write, so lightningd reads the raw bytes
+    # along with the response.
+    resp["attachment_length"] = len(attachment)
+    write(json.dumps(resp).encode() + attachment)
+
+
+def getmanifest(params):
+    global attachments
+    attachments = params.get("attachments", False)
+    return {"options": [{"name": o, "type": "string", "default": "",
+                         "description": ""} for o in OPTIONS],
+            "rpcmethods": [{"name": m, "usage": "", "description": ""}
+                           for m in ("getrawblockbyheight", "getchaininfo",
+                                     "estimatefees", "sendrawtransaction",
+                                     "getutxout")],
+            "dynamic": False,
+            "nonnumericids": True,
+            "attachments": attachments}
+
+
+def init(params):
+    options.update(params["options"])
+    return {}
+
+
+def getrawblockbyheight(params):
+    bhash = bcli(["getblockhash", str(params["height"])])
+    if bhash is None:
+        return {"blockhash": None, "block": None}, None
+    bhash = bhash.strip()
+    block = bcli(["getblock", bhash, "0"]).strip()
+    if not attachments:
+        return {"blockhash": bhash, "block": block}, None
+    return {"blockhash": bhash}, bytes.fromhex(block)
+
+
+def getchaininfo(params):
+    info = json.loads(bcli(["getblockchaininfo"]))
+    return {"chain": info['chain'],
+            "headercount": info['headers'],
+            "blockcount": info['blocks'],
+            "ibd": info['initialblockdownload']}
+
+
+def estimatefees(params):
+    return {"feerate_floor": 1000,
+            "feerates": [{"blocks": 2, "feerate": 1270000000},
+                         {"blocks": 6, "feerate": 1240000000},
+                         {"blocks": 12, "feerate": 1350000000},
+                         {"blocks": 100, "feerate": 3610000000}]}
+
+
+def sendrawtransaction(params):
+    bcli(["sendrawtransaction", params["tx"]])
+    return {'success': True}
+
+
+def getutxout(params):
+    txoutstr = bcli(["gettxout", params["txid"], str(params["vout"])]).strip()
+    if txoutstr == "":
+        return {"amount": None, "script": None}
+    txout = json.loads(txoutstr)
+    return {"amount": txout['value'],
+            "script": txout['scriptPubKey']['hex']}
+
+
+methods = {"getmanifest": getmanifest,
+           "init": init,
+           "getchaininfo": getchaininfo,
+           "estimatefees": estimatefees,
+           "sendrawtransaction": sendrawtransaction,
+           "getutxout": getutxout}
+
+decoder = json.JSONDecoder()
+buf = ""
+while True:
+    data = os.read(sys.stdin.fileno(), 65536)
+    if not data:
+        break
+    buf += data.decode()
+    while True:
+        buf = buf.lstrip()
+        try:
+            req, end = decoder.raw_decode(buf)
+        except ValueError:
+            break
+        buf = buf[end:]
+
+        # Notifications need no reply.
+        if "id" not in req:
+            continue
+        if req["method"] == "getrawblockbyheight":
+            result, attachment = getrawblockbyheight(req["params"])
+            respond(req["id"], result, attachment)
+        else:
+            respond(req["id"], methods[req["method"]](req["params"]))
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""Like dblog.py, but registers db_write with a window and acknowledges
+the writes in batches, once they are committed.
+"""
+from pyln.client import Plugin, RpcError
+import sqlite3
+import threading
+
+plugin = Plugin()
+plugin.sqlite_pre_init_cmds = []
+plugin.initted = False
+plugin.pending = []
+plugin.lock = threading.Lock()
+plugin.timer = None
+
+BATCH = 4
+
+
+@plugin.init()
+def init(configuration, options, plugin):
+    if not plugin.get_option('dblog-file'):
+        raise RpcError("No dblog-file specified")
+    plugin.conn = sqlite3.connect(plugin.get_option('dblog-file'),
+                                  isolation_level=None,
+                                  check_same_thread=False)
+    plugin.conn.execute("PRAGMA foreign_keys = ON;")
+
+    with plugin.lock:
+        plugin.conn.execute("BEGIN TRANSACTION;")
+        for c in plugin.sqlite_pre_init_cmds:
+            plugin.conn.execute(c)
+        plugin.conn.execute("COMMIT;")
+        plugin.initted = True
+    plugin.log("initialized")
+
+
+def flush():
+    with plugin.lock:
+        plugin.timer = None
+        if not plugin.pending:
+            return
+        plugin.conn.execute("BEGIN TRANSACTION;")
+        for _, writes in plugin.pending:
+            for c in writes:
+                plugin.conn.execute(c)
+        plugin.conn.execute("COMMIT;")
+        plugin.log("acknowledging {} writes".format(len(plugin.pending)))
+        for request, _ in plugin.pending:
+            request.set_result({"result": "continue"})
+        plugin.pending = []
+
+
+def db_write(plugin, writes, request, **kwargs):
+    with plugin.lock:
+        if not plugin.initted:
+            plugin.sqlite_pre_init_cmds += writes
+            request.set_result({"result": "continue"})
+            return
+        plugin.pending.append((request, writes))
+        full = len(plugin.pending) >= BATCH
+        if not full and plugin.timer is None:
+            # lightningd may be waiting for us: don't sit on a partial batch.
+            plugin.timer = threading.Timer(0.1, flush)
+            plugin.timer.start()
+    if full:
+        flush()
+
+
+plugin.add_hook('db_write', db_write, background=True, window=BATCH)
+plugin.add_option('dblog-file', None, 'The db file to create.')
+plugin.run()
@@ -0,0 +1,13 @@
+#!/usr/bin/env python3
+"""Tries to use filters on a hook which doesn't support them"""
+from pyln.client import Plugin
+
+plugin = Plugin()
+
+
+@plugin.hook("htlc_accepted", filters=["foo"])
+def on_htlc_accepted(onion, htlc, **kwargs):
+    return {"result": "continue"}
+
+
+plugin.run()
@@ -0,0 +1,16 @@
+#!/usr/bin/env python3
+"""Observes htlc_accepted, and never answers.
+
+Since it registers as observe-only, lightningd must not wait for it.
+"""
+from pyln.client import Plugin
+
+plugin = Plugin()
+
+
+def on_htlc_accepted(htlc, onion, plugin, request, **kwargs):
+    plugin.log("observed htlc {}".format(htlc['payment_hash']))
+
+
+plugin.add_hook('htlc_accepted', on_htlc_accepted, background=True, observe=True)
+plugin.run()
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+"""Emits bursts of "flood" notifications, and counts the ones it receives.
+
+Can be loaded several times under different filenames: the methods are
+suffixed with the filename so they don't clash.
+"""
+from pyln.client import Plugin
+import os
+
+
+plugin = Plugin()
+name = os.path.splitext(os.path.basename(__file__))[0]
+received = 0
+
+
+def flood(plugin, count):
+    for i in range(count):
+        plugin.notify("flood", {"i": i})
+    return {"sent": count}
+
+
+def floodcount(plugin):
+    return {"received": received}
+
+
+@plugin.subscribe("flood")
+def on_flood(origin, payload, **kwargs):
+    global received
+    received += 1
+
+
+plugin.add_method("flood-" + name, flood)
+plugin.add_method("floodcount-" + name, floodcount)
+plugin.add_notification_topic("flood")
+plugin.run()
@@ -0,0 +1,16 @@
+#!/usr/bin/env python3
+"""
+This plugin is used to test filters on the `rpc_command` hook.
+"""
+from pyln.client import Plugin
+
+plugin = Plugin()
+
+
+@plugin.hook("rpc_command", filters=["getinfo", "list*"])
+def on_rpc_command(plugin, rpc_command, **kwargs):
+    plugin.log("rpc_command_filtered saw {}".format(rpc_command["method"]))
+    return {"result": "continue"}
+
+
+plugin.run()
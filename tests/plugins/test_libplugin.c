@@ -143,6 +143,53 @@ static struct command_result *json_testrpc(struct command *cmd,
 	return send_outreq(cmd->plugin, req);
 }
 
+struct burst {
+	u32 count, outstanding;
+};
+
+static struct command_result *burst_done(struct command *cmd,
+					 const char *buf,
+					 const jsmntok_t *result,
+					 struct burst *burst)
+{
+	struct json_stream *response;
+
+	if (--burst->outstanding != 0)
+		return command_still_pending(cmd);
+
+	response = jsonrpc_stream_success(cmd);
+	json_add_u32(response, "count", burst->count);
+	return command_finished(cmd, response);
+}
+
+/* Fire off many requests at once, to test (and time) the rpc socket */
+static struct command_result *json_testrpc_burst(struct command *cmd,
+						 const char *buf,
+						 const jsmntok_t *params)
+{
+	struct burst *burst = tal(cmd, struct burst);
+	u32 *count;
+
+	if (!param(cmd, buf, params,
+		   p_opt_def("count", param_number, &count, 100),
+		   NULL))
+		return command_param_failed();
+
+	if (*count == 0)
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "count must be non-zero");
+
+	burst->count = burst->outstanding = *count;
+	for (size_t i = 0; i < *count; i++) {
+		struct out_req *req;
+
+		req = jsonrpc_request_start(cmd->plugin, cmd, "listdatastore",
+					    burst_done, burst_done, burst);
+		send_outreq(cmd->plugin, req);
+	}
+	return command_still_pending(cmd);
+}
+
 static struct command_result *listdatastore_ok(struct command *cmd,
 					       const char *buf,
 					       const jsmntok_t *params,
@@ -263,6 +310,13 @@ static const struct plugin_command commands[] = { {
 		"",
 		json_checkthis,
 	},
+	{
+		"testrpc-burst",
+		"utils",
+		"Makes {count} listdatastore calls at once, to test rpc socket.",
+		"",
+		json_testrpc_burst,
+	},
 };
 
 static const char *before[] = { "dummy", NULL };
@@ -431,6 +431,69 @@ def test_second_channel(node_factory):
     l1.fundchannel(l3, 10**6)
 
 
+def test_wait_channels(node_factory, bitcoind, executor):
+    l1, l2, l3 = node_factory.get_nodes(3)
+
+    # Asking for 0 gives us current index.
+    waitres = l1.rpc.call('wait', {'subsystem': 'channels', 'indexname': 'created', 'nextvalue': 0})
+    assert waitres == {'subsystem': 'channels', 'created': 0}
+
+    waitfut = executor.submit(l1.rpc.call, 'wait', {'subsystem': 'channels', 'indexname': 'created', 'nextvalue': 1})
+    time.sleep(1)
+
+    l1.rpc.connect(l2.info['id'], 'localhost', l2.port)
+    l1.rpc.connect(l3.info['id'], 'localhost', l3.port)
+    l1.fundchannel(l2, 10**6)
+    waitres = waitfut.result(TIMEOUT)
+    assert waitres['subsystem'] == 'channels'
+    assert waitres['created'] == 1
+    assert waitres['details']['peer_id'] == l2.info['id']
+    assert waitres['details']['channel_id'] == first_channel_id(l1, l2)
+    l1.fundchannel(l3, 10**6)
+
+    chans = l1.rpc.call('listpeerchannels', {'index': 'created'})['channels']
+    assert [c['peer_id'] for c in chans] == [l2.info['id'], l3.info['id']]
+    assert [c['created_index'] for c in chans] == [1, 2]
+    chans = l1.rpc.call('listpeerchannels', {'index': 'created', 'start': 2})['channels']
+    assert only_one(chans)['peer_id'] == l3.info['id']
+    chans = l1.rpc.call('listpeerchannels', {'index': 'created', 'start': 1, 'limit': 1})['channels']
+    assert only_one(chans)['peer_id'] == l2.info['id']
+
+    with pytest.raises(RpcError, match='Can only specify {start} with {index}'):
+        l1.rpc.call('listpeerchannels', {'start': 1})
+    with pytest.raises(RpcError, match='Cannot list channels by {index} deleted'):
+        l1.rpc.call('listpeerchannels', {'index': 'deleted'})
+
+    # HTLCs coming and going change spendable_msat, so they're updates too.
+    updated = l1.rpc.call('wait', {'subsystem': 'channels', 'indexname': 'updated', 'nextvalue': 0})['updated']
+    l1.rpc.pay(l2.rpc.invoice(10**6, 'test_wait_channels', 'desc')['bolt11'])
+    wait_for(lambda: only_one(l1.rpc.listpeerchannels(l2.info['id'])['channels'])['htlcs'] == [])
+    chan = only_one(l1.rpc.listpeerchannels(l2.info['id'])['channels'])
+    delta = only_one(l1.rpc.call('listpeerchannels', {'index': 'updated', 'start': updated + 1})['channels'])
+    assert delta['updated_index'] == chan['updated_index']
+    assert delta['spendable_msat'] == chan['spendable_msat']
+    assert delta['htlcs'] == []
+
+    # Disconnecting is an update (we show "connected").
+    updated = l1.rpc.call('wait', {'subsystem': 'channels', 'indexname': 'updated', 'nextvalue': 0})['updated']
+    l1.rpc.disconnect(l3.info['id'], force=True)
+    wait_for(lambda: l1.rpc.call('wait', {'subsystem': 'channels', 'indexname': 'updated', 'nextvalue': 0})['updated'] > updated)
+
+    chans = l1.rpc.call('listpeerchannels', {'index': 'updated', 'start': updated + 1})['channels']
+    assert only_one(chans)['peer_id'] == l3.info['id']
+    assert only_one(chans)['peer_connected'] is False
+    assert only_one(chans)['updated_index'] > updated
+
+    # Forgetting a channel bumps deleted.
+    waitres = l1.rpc.call('wait', {'subsystem': 'channels', 'indexname': 'deleted', 'nextvalue': 0})
+    assert waitres == {'subsystem': 'channels', 'deleted': 0}
+
+    l1.rpc.close(l2.info['id'])
+    bitcoind.generate_block(100, wait_for_mempool=1)
+    wait_for(lambda: l1.rpc.call('wait', {'subsystem': 'channels', 'indexname': 'deleted', 'nextvalue': 0})['deleted'] == 1)
+    assert only_one(l1.rpc.call('listpeerchannels', {'index': 'created'})['channels'])['peer_id'] == l3.info['id']
+
+
 def test_channel_abandon(node_factory, bitcoind):
     """Our open tx isn't mined, we doublespend it away"""
     l1, l2 = node_factory.get_nodes(2)
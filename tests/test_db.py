@@ -519,3 +519,39 @@ def test_db_forward_migrate(bitcoind, node_factory):
     l1.daemon.opts['autoclean-cycle'] = 1
     l1.start()
     wait_for(lambda: l1.rpc.listforwards()['forwards'] == [])
+
+
+def test_dbprofile(node_factory):
+    plugin = os.path.join(os.getcwd(), 'tests/plugins/all_notifications.py')
+    l1 = node_factory.get_node(options={'plugin': plugin})
+
+    assert l1.rpc.dbprofile()['enabled'] is False
+    assert 'queries' not in l1.rpc.dbprofile()
+
+    with pytest.raises(RpcError, match='Can only specify {slow_msec} with {enable}=true'):
+        l1.rpc.dbprofile(slow_msec=100)
+
+    prof = l1.rpc.dbprofile(enable=True)
+    assert prof['enabled'] is True
+    assert prof['queries'] == []
+
+    for i in range(5):
+        l1.rpc.invoice(1000, f'inv{i}', 'desc')
+
+    prof = l1.rpc.dbprofile()
+    assert prof['transactions']['count'] >= 5
+    assert len(prof['queries']) > 0
+    totals = [q['total_usec'] for q in prof['queries']]
+    assert totals == sorted(totals, reverse=True)
+    inserts = [q for q in prof['queries'] if q['query'].startswith('INSERT INTO invoices')]
+    assert len(inserts) == 1
+    assert inserts[0]['executions'] == 5
+    assert inserts[0]['bytes_bound'] > 0
+
+    # Everything is slower than 0 msec.
+    l1.rpc.dbprofile(enable=True, slow_msec=0)
+    l1.rpc.invoice(1000, 'inv5', 'desc')
+    l1.daemon.wait_for_log(r"plugin-all_notifications.py: notification db_slow_query: {'db_slow_query': {'location': '.*', 'query': 'INSERT INTO invoices .*', 'rows': [0-9]+, 'usec': [0-9]+}}")
+    assert l1.rpc.dbprofile()['transactions']['count'] > 0
+    assert l1.rpc.dbprofile(enable=False)['enabled'] is False
+    assert 'queries' not in l1.rpc.dbprofile()
@@ -910,6 +910,19 @@ def test_listinvoices_index(node_factory, executor):
         assert only_one(l2.rpc.listinvoices(index='updated', start=i, limit=1)['invoices'])['label'] == str(70 + 1 - i)
 
 
+def test_listinvoices_batches(node_factory):
+    """Large listings are produced in batches of 1000: check the seams."""
+    l1 = node_factory.get_node()
+
+    for i in range(1, 2002):
+        l1.rpc.invoice(i, str(i), "test_listinvoices_batches")
+
+    assert [inv['label'] for inv in l1.rpc.listinvoices()['invoices']] == [str(i) for i in range(1, 2002)]
+    assert [inv['label'] for inv in l1.rpc.listinvoices(index='created', start=2, limit=1000)['invoices']] == [str(i) for i in range(2, 1002)]
+    assert [inv['label'] for inv in l1.rpc.listinvoices(index='created', start=1000, limit=1001)['invoices']] == [str(i) for i in range(1000, 2001)]
+    assert [inv['label'] for inv in l1.rpc.listinvoices(index='created', start=1001)['invoices']] == [str(i) for i in range(1001, 2002)]
+
+
 def test_unified_invoices(node_factory, executor, bitcoind):
     l1, l2 = node_factory.line_graph(2, opts={'invoices-onchain-fallback': None})
     amount_sat = 1000
@@ -3205,6 +3205,79 @@ def test_listforwards_and_listhtlcs(node_factory, bitcoind):
     assert l2.rpc.listforwards() == {'forwards': []}
 
 
+def test_archiveforwards(node_factory):
+    l1, l2, l3 = node_factory.line_graph(3, wait_for_announce=True)
+
+    for i in range(3):
+        inv = l3.rpc.invoice(1000 + i, f'inv{i}', 'desc')
+        l1.rpc.pay(inv['bolt11'])
+
+    forwards = l2.rpc.listforwards()['forwards']
+    fees = l2.rpc.getinfo()['fees_collected_msat']
+    assert len(forwards) == 3
+
+    # Nothing is that old.
+    assert l2.rpc.archiveforwards(age=3600) == {'archived': 0}
+    assert l2.rpc.archiveforwards(age=0) == {'archived': 3}
+    assert l2.rpc.archiveforwards(age=0) == {'archived': 0}
+
+    # Archived forwards look exactly the same.
+    assert l2.rpc.listforwards()['forwards'] == forwards
+    assert l2.rpc.getinfo()['fees_collected_msat'] == fees
+    assert l2.rpc.listforwards(index='created', start=2)['forwards'] == forwards[1:]
+
+    # New ones are interleaved with archived ones.
+    inv = l3.rpc.invoice(2000, 'inv3', 'desc')
+    l1.rpc.pay(inv['bolt11'])
+    forwards = l2.rpc.listforwards()['forwards']
+    fees = l2.rpc.getinfo()['fees_collected_msat']
+    assert [f['created_index'] for f in forwards] == [1, 2, 3, 4]
+    assert l2.rpc.listforwards(index='created', start=3, limit=2)['forwards'] == forwards[2:]
+
+    # Survives a restart, and we can still delete archived ones.
+    l2.restart()
+    assert l2.rpc.listforwards()['forwards'] == forwards
+    l2.rpc.delforward(forwards[0]['in_channel'], forwards[0]['in_htlc_id'], 'settled')
+    assert l2.rpc.listforwards()['forwards'] == forwards[1:]
+    # Deleted fees are still counted.
+    assert l2.rpc.getinfo()['fees_collected_msat'] == fees
+
+
+@unittest.skipIf(os.getenv('TEST_DB_PROVIDER', 'sqlite3') != 'sqlite3', "sqlite3-specific DB manip")
+def test_listforwards_batches(node_factory):
+    """Large listings are produced in batches of 1000: check the seams."""
+    l1 = node_factory.get_node()
+    l1.stop()
+
+    # Far quicker than making 2001 real forwards.  Every third one failed.
+    l1.db_manip("INSERT INTO forwards"
+                " (in_channel_scid, in_htlc_id, out_channel_scid, out_htlc_id,"
+                "  in_msatoshi, out_msatoshi, state, received_time,"
+                "  resolved_time, failcode, forward_style, updated_index)"
+                " WITH RECURSIVE n(i) AS"
+                "  (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 2001)"
+                " SELECT"
+                "  CASE WHEN i % 2 = 0 THEN {} ELSE {} END,"
+                "  i, {}, i, 1001, 1000,"
+                "  CASE WHEN i % 3 = 0 THEN 2 ELSE 1 END,"
+                "  i * 1000000000, i * 1000000000 + 1, NULL, 0, 0"
+                " FROM n;".format((103 << 40) | (1 << 16),
+                                  (104 << 40) | (1 << 16),
+                                  (105 << 40) | (1 << 16)))
+    l1.start()
+
+    def htlc_ids(**kwargs):
+        return [f['in_htlc_id'] for f in l1.rpc.listforwards(**kwargs)['forwards']]
+
+    assert htlc_ids() == list(range(1, 2002))
+    assert htlc_ids(index='created', start=2, limit=1000) == list(range(2, 1002))
+    assert htlc_ids(index='created', start=1000, limit=1001) == list(range(1000, 2001))
+    assert htlc_ids(index='created', start=1001) == list(range(1001, 2002))
+    assert htlc_ids(status='failed') == list(range(3, 2002, 3))
+    assert htlc_ids(in_channel='103x1x0') == list(range(2, 2002, 2))
+    assert htlc_ids(in_channel='104x1x0', status='settled') == [i for i in range(1, 2002, 2) if i % 3 != 0]
+
+
 def test_listforwards_wait(node_factory, executor):
     l1, l2, l3 = node_factory.line_graph(3, wait_for_announce=True)
 
@@ -3730,6 +3803,36 @@ def test_field_filter(node_factory, chainparams):
     assert res == {"currency": chainparams['bip173_prefix']}
 
 
+def test_field_filter_skips_fields(node_factory):
+    """Commands skip work for filtered-out fields: make sure what's left is right"""
+    l1, l2 = node_factory.line_graph(2, wait_for_announce=True)
+
+    chan = only_one(l1.rpc.listpeerchannels()['channels'])
+    res = l1.rpc.call('listpeerchannels', {},
+                      filter={"channels": [{"peer_id": True,
+                                            "spendable_msat": True}]})
+    assert res == {"channels": [{"peer_id": chan['peer_id'],
+                                 "spendable_msat": chan['spendable_msat']}]}
+
+    res = l1.rpc.call('listpeerchannels', {},
+                      filter={"channels": [{"state": True}]})
+    assert res == {"channels": [{"state": chan['state']}]}
+
+    # topology plugin does the same.
+    chans = l1.rpc.listchannels()['channels']
+    res = l1.rpc.call('listchannels', {},
+                      filter={"channels": [{"short_channel_id": True,
+                                            "features": True}]})
+    assert res == {"channels": [{"short_channel_id": c['short_channel_id'],
+                                 "features": c['features']} for c in chans]}
+
+    nodes = l1.rpc.listnodes()['nodes']
+    res = l1.rpc.call('listnodes', {}, filter={"nodes": [{"nodeid": True}]})
+    assert res == {"nodes": [{"nodeid": n['nodeid']} for n in nodes]}
+    res = l1.rpc.call('listnodes', {}, filter={"nodes": [{"alias": True}]})
+    assert res == {"nodes": [{"alias": n['alias']} for n in nodes]}
+
+
 def test_checkmessage_pubkey_not_found(node_factory):
     l1 = node_factory.get_node()
 
@@ -1197,6 +1197,25 @@ def test_forward(node_factory, bitcoind):
     assert only_one(re.findall(expected_line, str(koinly_csv)))
 
 
+def test_forward_fulfill_before_commit(node_factory):
+    """We pass the preimage upstream as soon as we see it"""
+    # l3 hangs up as soon as it has sent the preimage, and neither side
+    # reconnects, so l2 never gets a commitment_signed for the removal.
+    l1, l2, l3 = node_factory.line_graph(3, wait_for_announce=True,
+                                         opts=[{},
+                                               {'dev-no-reconnect': None},
+                                               {'dev-no-reconnect': None,
+                                                'disconnect': ['+WIRE_UPDATE_FULFILL_HTLC']}])
+
+    inv = l3.rpc.invoice(100000, 'early', 'early')
+    l1.rpc.pay(inv['bolt11'])
+    l2.daemon.wait_for_log(r'HTLC 0 fulfilled: passing upstream')
+    wait_for(lambda: only_one(l2.rpc.listpeers(l3.info['id'])['peers'])['connected'] is False)
+
+    # Forward is only recorded once l3 commits to it.
+    assert l2.rpc.listforwards(status='settled')['forwards'] == []
+
+
 def test_forward_different_fees_and_cltv(node_factory, bitcoind):
     # FIXME: Check BOLT quotes here too
     # BOLT #7:
@@ -3082,6 +3101,33 @@ def test_sendonion_rpc(node_factory):
         assert(e.error['data']['raw_message'] == "400f00000000000003e80000006c")
 
 
+def test_sendonion_bad_ephemeral_key(node_factory):
+    """channeld can't get a shared secret from this onion: the HTLC gets
+    failed as WIRE_INVALID_ONION_KEY, and the channel is unaffected."""
+    l1, l2 = node_factory.line_graph(2)
+
+    inv = l2.rpc.invoice(123000, 'badkey', 'badkey')
+    first_hop = only_one(l1.rpc.getroute(l2.info['id'], 123000, 1)['route'])
+
+    # Version 0, then a 0x04 "pubkey", which isn't a valid compressed point.
+    onion = '00' + '04' + '00' * 32 + '00' * 1300 + '00' * 32
+    l1.rpc.sendonion(onion=onion, first_hop=first_hop,
+                     payment_hash=inv['payment_hash'])
+    with pytest.raises(RpcError) as err:
+        l1.rpc.waitsendpay(inv['payment_hash'])
+
+    # FIXME: #define PAY_UNPARSEABLE_ONION		202
+    PAY_UNPARSEABLE_ONION = 202
+    assert err.value.error['code'] == PAY_UNPARSEABLE_ONION
+    # FIXME: WIRE_INVALID_ONION_KEY = BADONION|PERM|6
+    WIRE_INVALID_ONION_KEY = 0x8000 | 0x4000 | 6
+    assert err.value.error['data']['failcode'] == WIRE_INVALID_ONION_KEY
+
+    # Still good for a real payment.
+    l1.rpc.pay(inv['bolt11'])
+    assert only_one(l1.rpc.listpeerchannels()['channels'])['state'] == 'CHANNELD_NORMAL'
+
+
 @pytest.mark.openchannel('v1')
 @pytest.mark.openchannel('v2')
 def test_partial_payment(node_factory, bitcoind, executor):
@@ -4011,6 +4057,36 @@ def test_listpay_result_with_paymod(node_factory, bitcoind):
     assert 'destination' in l2.rpc.listpays()['pays'][0]
 
 
+@unittest.skipIf(os.getenv('TEST_DB_PROVIDER', 'sqlite3') != 'sqlite3', "sqlite3-specific DB manip")
+def test_listsendpays_batches(node_factory):
+    """Large listings are produced in batches of 1000: check the seams."""
+    l1 = node_factory.get_node()
+    l1.stop()
+
+    # Far quicker than making 2001 real payments.  Every third one failed.
+    l1.db_manip("INSERT INTO payments"
+                " (id, status, payment_hash, destination, msatoshi, timestamp,"
+                "  msatoshi_sent, total_msat, partid, groupid, updated_index)"
+                " WITH RECURSIVE n(i) AS"
+                "  (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 2001)"
+                " SELECT"
+                "  i, CASE WHEN i % 3 = 0 THEN 2 ELSE 1 END, zeroblob(32),"
+                "  NULL, 1000, i, 1001, 1000, i, 0, 0"
+                " FROM n;")
+    l1.start()
+
+    def partids(**kwargs):
+        return [p['partid'] for p in l1.rpc.listsendpays(**kwargs)['payments']]
+
+    assert partids() == list(range(1, 2002))
+    assert partids(index='created', start=2, limit=1000) == list(range(2, 1002))
+    assert partids(index='created', start=1000, limit=1001) == list(range(1000, 2001))
+    assert partids(index='created', start=1001) == list(range(1001, 2002))
+    assert partids(status='failed') == list(range(3, 2002, 3))
+    assert partids(status='complete') == [i for i in range(1, 2002) if i % 3 != 0]
+    assert partids(status='complete', index='created', start=1000, limit=600) == [i for i in range(1000, 2002) if i % 3 != 0][:600]
+
+
 def test_listsendpays_and_listpays_order(node_factory):
     """listsendpays should be in increasing id order, listpays in created_at"""
     l1, l2 = node_factory.line_graph(2)
@@ -589,6 +589,30 @@ def test_db_hook_multiple(node_factory, executor):
     assert [x for x in db1.iterdump()] == [x for x in db2.iterdump()]
 
 
+@unittest.skipIf(os.getenv('TEST_DB_PROVIDER', 'sqlite3') != 'sqlite3', "Only sqlite3 implements the db_write_hook currently")
+def test_db_hook_window(node_factory, executor):
+    """This tests the db hook with writes acknowledged in batches."""
+    dbfile = os.path.join(node_factory.directory, "dblog.sqlite3")
+    l1, l2 = node_factory.line_graph(2, opts=[{'plugin': os.path.join(os.getcwd(), 'tests/plugins/dblog-window.py'),
+                                               'dblog-file': dbfile},
+                                              {}])
+
+    # Commitment updates have to wait for the backup, but still work.
+    for i in range(5):
+        inv = l2.rpc.invoice(1000, 'test_db_hook_window{}'.format(i), 'desc')
+        l1.rpc.pay(inv['bolt11'])
+
+    l1.daemon.wait_for_log(r'plugin-dblog-window.py: acknowledging \d+ writes')
+
+    l1.stop()
+
+    # Databases should be identical.
+    db1 = sqlite3.connect(os.path.join(l1.daemon.lightning_dir, TEST_NETWORK, 'lightningd.sqlite3'))
+    db2 = sqlite3.connect(dbfile)
+
+    assert [x for x in db1.iterdump()] == [x for x in db2.iterdump()]
+
+
 def test_utf8_passthrough(node_factory, executor):
     l1 = node_factory.get_node(options={'plugin': os.path.join(os.getcwd(), 'tests/plugins/utf8.py'),
                                         'log-level': 'io'})
@@ -1096,6 +1120,10 @@ def test_channel_state_change_history(node_factory, bitcoind):
         assert(history[3]['new_state'] == "CLOSINGD_COMPLETE")
         assert(history[3]['message'] == "Closing complete")
 
+    # This is served from memory, but must match what's in the db.
+    l1.restart()
+    assert l1.rpc.listpeerchannels()['channels'][0]['state_changes'] == history
+
 
 def test_htlc_accepted_hook_fail(node_factory):
     """Send payments from l1 to l2, but l2 just declines everything.
@@ -1543,6 +1571,27 @@ def test_rpc_command_hook(node_factory):
     l1.rpc.jsonschemas = schemas
 
 
+def test_rpc_command_hook_filters(node_factory):
+    """An rpc_command hook with filters only sees the commands it asked for"""
+    plugin = os.path.join(os.getcwd(), "tests/plugins/rpc_command_filtered.py")
+    l1 = node_factory.get_node(options={"plugin": plugin})
+
+    l1.rpc.getinfo()
+    l1.daemon.wait_for_log("rpc_command_filtered saw getinfo")
+    l1.rpc.listfunds()
+    l1.daemon.wait_for_log("rpc_command_filtered saw listfunds")
+
+    l1.rpc.invoice(10**6, "test_filters", "test_filters")
+    l1.rpc.getinfo()
+    l1.daemon.wait_for_log("rpc_command_filtered saw getinfo")
+    assert not l1.daemon.is_in_log("rpc_command_filtered saw invoice")
+
+    # Filters only make sense for rpc_command
+    with pytest.raises(RpcError, match=r"does not support filters"):
+        l1.rpc.plugin_start(os.path.join(os.getcwd(),
+                                         "tests/plugins/htlc_accepted-filtered.py"))
+
+
 def test_libplugin(node_factory):
     """Sanity checks for plugins made with libplugin"""
     plugin = os.path.join(os.getcwd(), "tests/plugins/test_libplugin")
@@ -1624,8 +1673,10 @@ def test_libplugin(node_factory):
     l1.daemon.wait_for_log("{} peer_connected".format(l2.info["id"]))
     l1.daemon.wait_for_log("{} connected".format(l2.info["id"]))
 
-    # Test RPC calls FIXME: test concurrent ones ?
+    # Test RPC calls
     assert l1.rpc.call("testrpc") == l1.rpc.getinfo()
+    # Concurrent ones get written out together.
+    assert l1.rpc.call("testrpc-burst", {'count': 500}) == {'count': 500}
 
     # Make sure deprecated options nor commands are mentioned.
     with pytest.raises(RpcError, match=r'Command "testrpc-deprecated" is deprecated'):
@@ -1842,6 +1893,32 @@ def test_bitcoin_bad_estimatefee(node_factory, bitcoind):
     l1.rpc.fundchannel(l2.info["id"], 50 * 10**8)
 
 
+@unittest.skipIf(TEST_NETWORK != 'regtest', 'elementsd has no -blockversion')
+def test_bitcoin_backend_attachments(node_factory, bitcoind):
+    """
+    A Bitcoin backend which sends blocks as attachments, in the same write
+    as the JSON response.
+    """
+    # A version signalling a BIP9 bit, so the block (and so the attachment)
+    # doesn't start with a 0 byte.
+    bitcoind.stop()
+    bitcoind.cmd_line += ["-blockversion={}".format(0x20000004)]
+    bitcoind.start()
+
+    plugin = os.path.join(os.getcwd(), "tests/plugins/chunked_bcli.py")
+    l1 = node_factory.get_node(options={"disable-plugin": "bcli",
+                                        "plugin": plugin})
+
+    bitcoind.generate_block(3)
+    sync_blockheight(bitcoind, [l1])
+    tip = bitcoind.rpc.getblock(bitcoind.rpc.getbestblockhash())
+    assert tip['version'] == 0x20000004
+
+    # Including ones with our transactions in them.
+    l1.fundwallet(10**6)
+    assert only_one(l1.rpc.listfunds()['outputs'])['amount_msat'] == 10**9
+
+
 def test_bcli(node_factory, bitcoind, chainparams):
     """
     This tests the bcli plugin, used to gather Bitcoin data from a local
@@ -2456,6 +2533,20 @@ def test_hook_dep_stable(node_factory):
     l2.daemon.wait_for_log(r"dep_b.py: htlc_accepted called")
 
 
+def test_htlc_accepted_hook_observe(node_factory):
+    """An observe-only hook subscription doesn't hold up the HTLC"""
+    observer = os.path.join(os.path.dirname(__file__), 'plugins/htlc_accepted-observe.py')
+    dep_a = os.path.join(os.path.dirname(__file__), 'plugins/dep_a.py')
+    l1, l2 = node_factory.line_graph(2, opts=[{}, {'plugin': [observer, dep_a]}])
+
+    inv = l2.rpc.invoice(1000, 'observe', 'observe')
+    # The observer never replies, but the payment still goes through.
+    l1.rpc.pay(inv['bolt11'])
+    l2.daemon.wait_for_log(r'htlc_accepted-observe.py: observed htlc {}'.format(inv['payment_hash']))
+    l2.daemon.wait_for_log(r'dep_a.py: htlc_accepted called')
+    assert only_one(l2.rpc.listinvoices('observe')['invoices'])['status'] == 'paid'
+
+
 def test_htlc_accepted_hook_failonion(node_factory):
     plugin = os.path.join(os.path.dirname(__file__), 'plugins/htlc_accepted-failonion.py')
     l1, l2 = node_factory.line_graph(2, opts=[{}, {'plugin': plugin}])
@@ -3293,6 +3384,47 @@ def test_autoclean_timer_crash(node_factory):
     time.sleep(20)
 
 
+def test_bulk_deletes(node_factory):
+    """delforwards, delpays and delinvoices, as used by autoclean"""
+    l1, l2, l3 = node_factory.line_graph(3, wait_for_announce=True)
+
+    for i in range(3):
+        inv = l3.rpc.invoice(amount_msat=12300, label='inv{}'.format(i),
+                             description='desc')
+        l1.rpc.pay(inv['bolt11'])
+    l3.rpc.invoice(amount_msat=12300, label='unpaid', description='desc')
+
+    # Make sure > 1 second old!
+    time.sleep(2)
+
+    assert l3.rpc.delinvoices(status='paid', age=1) == {'deleted': 3}
+    assert [i['label'] for i in l3.rpc.listinvoices()['invoices']] == ['unpaid']
+    assert l3.rpc.delinvoices(status='paid', age=1) == {'deleted': 0}
+    assert l3.rpc.delinvoices(status='expired', age=1) == {'deleted': 0}
+    assert l3.rpc.wait(subsystem='invoices', indexname='deleted', nextvalue=3)['deleted'] == 3
+
+    # Nothing is that old.
+    assert l1.rpc.delpays(status='complete', age=3600) == {'deleted': 0}
+    assert l1.rpc.delpays(status='complete', age=1) == {'deleted': 3}
+    assert l1.rpc.listsendpays()['payments'] == []
+    assert l1.rpc.wait(subsystem='sendpays', indexname='deleted', nextvalue=3)['deleted'] == 3
+
+    fees = l2.rpc.getinfo()['fees_collected_msat']
+    assert l2.rpc.delforwards(status='failed', age=1) == {'deleted': 0}
+    assert l2.rpc.delforwards(status='settled', age=1) == {'deleted': 3}
+    assert l2.rpc.listforwards()['forwards'] == []
+    assert l2.rpc.wait(subsystem='forwards', indexname='deleted', nextvalue=3)['deleted'] == 3
+    # Fees are remembered, as with delforward.
+    assert l2.rpc.getinfo()['fees_collected_msat'] == fees
+
+    with pytest.raises(RpcError, match='delforward status cannot be offered'):
+        l2.rpc.delforwards(status='offered', age=1)
+    with pytest.raises(RpcError, match='Cannot delete pending status'):
+        l1.rpc.delpays(status='pending', age=1)
+    with pytest.raises(RpcError, match="should be 'paid' or 'expired'"):
+        l3.rpc.delinvoices(status='unpaid', age=1)
+
+
 def test_autoclean_once(node_factory):
     l1, l2, l3 = node_factory.line_graph(3, opts={'may_reconnect': True},
                                          wait_for_announce=True)
@@ -4210,6 +4342,46 @@ def test_sql(node_factory, bitcoind):
     wait_for(lambda: l3.rpc.sql("SELECT * FROM nodes WHERE alias = '{}'".format(alias))['rows'] != [])
 
 
+def test_sql_incremental(node_factory, executor):
+    l1 = node_factory.get_node()
+
+    for i in range(5):
+        l1.rpc.invoice(1000 + i, 'inv{}'.format(i), 'desc')
+
+    assert l1.rpc.sql("SELECT COUNT(*) FROM invoices;")['rows'] == [[5]]
+    l1.daemon.wait_for_log('Full refresh of invoices')
+
+    # New entries are fetched without reloading everything.
+    l1.rpc.invoice(2000, 'inv5', 'desc')
+    assert l1.rpc.sql("SELECT COUNT(*) FROM invoices;")['rows'] == [[6]]
+    l1.daemon.wait_for_log('Refreshing invoices created > 5, updated > 0')
+
+    # Updated entries replace the old ones.
+    l1.rpc.delinvoice('inv0', 'unpaid', desconly=True)
+    assert l1.rpc.sql("SELECT description FROM invoices WHERE label = 'inv0';")['rows'] == [[None]]
+    l1.daemon.wait_for_log('Refreshing invoices created > 6, updated > 0')
+
+    l1.rpc.invoice(3000, 'inv6', 'desc', expiry=1)
+    wait_for(lambda: only_one(l1.rpc.listinvoices('inv6')['invoices'])['status'] == 'expired')
+    assert l1.rpc.sql("SELECT status FROM invoices WHERE label = 'inv6';")['rows'] == [['expired']]
+    assert l1.rpc.sql("SELECT COUNT(*) FROM invoices;")['rows'] == [[7]]
+    assert not l1.daemon.is_in_log('Full refresh of invoices',
+                                   start=l1.daemon.logsearch_start)
+
+    # A deletion forces a full reload.
+    l1.rpc.delinvoice('inv1', 'unpaid')
+    assert l1.rpc.sql("SELECT label FROM invoices ORDER BY created_index;")['rows'] == [['inv0'], ['inv2'], ['inv3'], ['inv4'], ['inv5'], ['inv6']]
+    l1.daemon.wait_for_log('Full refresh of invoices')
+
+    # Concurrent queries which fetch the same new entries don't duplicate them.
+    for i in range(7, 12):
+        l1.rpc.invoice(4000 + i, 'inv{}'.format(i), 'desc')
+    futs = [executor.submit(l1.rpc.sql, "SELECT COUNT(*) FROM invoices;") for _ in range(5)]
+    for f in futs:
+        f.result(TIMEOUT)
+    assert l1.rpc.sql("SELECT COUNT(*), COUNT(DISTINCT created_index) FROM invoices;")['rows'] == [[11, 11]]
+
+
 def test_sql_deprecated(node_factory, bitcoind):
     # deprecated-apis breaks schemas...
     l1 = node_factory.get_node(start=False, options={'allow-deprecated-apis': True})
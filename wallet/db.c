@@ -15,6 +15,7 @@
 #include <hsmd/hsmd_wiregen.h>
 #include <lightningd/channel.h>
 #include <lightningd/hsm_control.h>
+#include <lightningd/notification.h>
 #include <lightningd/plugin_hook.h>
 #include <sodium/randombytes.h>
 #include <stddef.h>
@@ -82,6 +83,8 @@ static void migrate_forwards_add_rowid(struct lightningd *ld,
 
 static void migrate_initialize_forwards_wait_indexes(struct lightningd *ld,
 						     struct db *db);
+static void migrate_initialize_channels_wait_indexes(struct lightningd *ld,
+						     struct db *db);
 static void migrate_initialize_alias_local(struct lightningd *ld,
 					   struct db *db);
 
@@ -1021,6 +1024,28 @@ static struct migration dbmigrations[] = {
     {SQL("ALTER TABLE channels ADD remote_htlc_minimum_msat BIGINT DEFAULT NULL;"), NULL},
     {SQL("ALTER TABLE channels ADD last_stable_connection BIGINT DEFAULT 0;"), NULL},
     {NULL, migrate_initialize_alias_local},
+    /* Old resolved forwards get moved here by archiveforwards: created_index
+     * is their rowid in forwards. */
+    {SQL("CREATE TABLE forwards_archive ("
+	 "  created_index BIGINT"
+	 ", in_channel_scid BIGINT"
+	 ", in_htlc_id BIGINT"
+	 ", out_channel_scid BIGINT"
+	 ", out_htlc_id BIGINT"
+	 ", in_msatoshi BIGINT"
+	 ", out_msatoshi BIGINT"
+	 ", state INTEGER"
+	 ", received_time BIGINT"
+	 ", resolved_time BIGINT"
+	 ", failcode INTEGER"
+	 ", forward_style INTEGER"
+	 ", updated_index BIGINT"
+	 ", PRIMARY KEY(created_index))"), NULL},
+    {SQL("CREATE INDEX forwards_archive_updated_idx ON forwards_archive (updated_index)"), NULL},
+    {SQL("CREATE INDEX forwards_archive_in_idx ON forwards_archive (in_channel_scid, in_htlc_id)"), NULL},
+    {SQL("ALTER TABLE channels ADD created_index BIGINT DEFAULT 0"), NULL},
+    {SQL("UPDATE channels SET created_index = id"), NULL},
+    {NULL, migrate_initialize_channels_wait_indexes},
 };
 
 /**
@@ -1098,6 +1123,12 @@ static void db_error(struct lightningd *ld, bool fatal, const char *fmt, va_list
 	va_end(ap2);
 }
 
+static void db_slow_query(struct db *db, const struct db_stmt *stmt)
+{
+	notify_db_slow_query(db->errorfn_arg, stmt->location,
+			     stmt->query->query, stmt->rows, stmt->elapsed);
+}
+
 struct db *db_setup(const tal_t *ctx, struct lightningd *ld,
 		    const struct ext_key *bip32_base)
 {
@@ -1106,6 +1137,8 @@ struct db *db_setup(const tal_t *ctx, struct lightningd *ld,
 	bool migrated;
 
 	db->report_changes_fn = plugin_hook_db_sync;
+	db->changes_wanted_fn = plugin_hook_db_wanted;
+	db->slow_query_fn = db_slow_query;
 
 	db_begin_transaction(db);
 	db->data_version = db_data_version_get(db);
@@ -1836,6 +1869,16 @@ static void migrate_initialize_forwards_wait_indexes(struct lightningd *ld,
 					"MAX(rowid)");
 }
 
+static void migrate_initialize_channels_wait_indexes(struct lightningd *ld,
+						     struct db *db)
+{
+	migrate_initialize_wait_indexes(db,
+					WAIT_SUBSYSTEM_CHANNEL,
+					WAIT_INDEX_CREATED,
+					SQL("SELECT MAX(created_index) FROM channels;"),
+					"MAX(created_index)");
+}
+
 static void complain_unfixed(struct lightningd *ld,
 			     enum channel_state state,
 			     u64 id,
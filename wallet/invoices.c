@@ -475,6 +475,84 @@ bool invoices_delete(struct invoices *invoices, u64 inv_dbid,
 	return true;
 }
 
+u32 invoices_delete_older(struct invoices *invoices,
+			  enum invoice_status status,
+			  u64 before,
+			  u32 max)
+{
+	struct db_stmt *stmt;
+	struct old_invoice {
+		u64 inv_dbid;
+		struct json_escape *label;
+		const char *invstring;
+	} *invs = tal_arr(tmpctx, struct old_invoice, 0);
+
+	/* Paid ones go by when they were paid, expired by when they expired */
+	assert(status == PAID || status == EXPIRED);
+	if (status == PAID)
+		stmt = db_prepare_v2(invoices->wallet->db,
+				     SQL("SELECT id, label, bolt11"
+					 "  FROM invoices"
+					 " WHERE state = ?"
+					 "   AND paid_timestamp <= ?"
+					 " ORDER BY id"
+					 " LIMIT ?;"));
+	else
+		stmt = db_prepare_v2(invoices->wallet->db,
+				     SQL("SELECT id, label, bolt11"
+					 "  FROM invoices"
+					 " WHERE state = ?"
+					 "   AND expiry_time <= ?"
+					 " ORDER BY id"
+					 " LIMIT ?;"));
+	db_bind_int(stmt, status);
+	db_bind_u64(stmt, before);
+	db_bind_int(stmt, max);
+	db_query_prepared(stmt);
+
+	while (db_step(stmt)) {
+		struct old_invoice inv;
+
+		inv.inv_dbid = db_col_u64(stmt, "id");
+		inv.label = db_col_json_escape(tmpctx, stmt, "label");
+		inv.invstring = db_col_strdup(tmpctx, stmt, "bolt11");
+		tal_arr_expand(&invs, inv);
+	}
+	tal_free(stmt);
+
+	if (tal_count(invs) == 0)
+		return 0;
+
+	/* They're the oldest, so this deletes exactly those. */
+	if (status == PAID)
+		stmt = db_prepare_v2(invoices->wallet->db,
+				     SQL("DELETE FROM invoices"
+					 " WHERE state = ?"
+					 "   AND paid_timestamp <= ?"
+					 "   AND id <= ?;"));
+	else
+		stmt = db_prepare_v2(invoices->wallet->db,
+				     SQL("DELETE FROM invoices"
+					 " WHERE state = ?"
+					 "   AND expiry_time <= ?"
+					 "   AND id <= ?;"));
+	db_bind_int(stmt, status);
+	db_bind_u64(stmt, before);
+	db_bind_u64(stmt, invs[tal_count(invs) - 1].inv_dbid);
+	db_exec_prepared_v2(take(stmt));
+
+	/* Tell all the waiters about the fact that they were deleted. */
+	for (size_t i = 0; i < tal_count(invs); i++) {
+		invoice_index_deleted(invoices->wallet->ld, status,
+				      invs[i].label, invs[i].invstring);
+		trigger_invoice_waiter_expire_or_delete(invoices,
+							invs[i].inv_dbid,
+							true);
+	}
+
+	return tal_count(invs);
+}
+
 bool invoices_delete_description(struct invoices *invoices, u64 inv_dbid,
 				 const struct json_escape *label,
 				 const char *description)
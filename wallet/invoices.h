@@ -144,6 +144,21 @@ bool invoices_delete(struct invoices *invoices,
 		     const struct json_escape *label,
 		     const char *invstring);
 
+/**
+ * invoices_delete_older - Delete old paid or expired invoices in bulk
+ *
+ * @invoices - the invoice handler.
+ * @status - PAID or EXPIRED.
+ * @before - delete those paid (or expired) no later than this time.
+ * @max - the most to delete.
+ *
+ * Returns the number deleted.
+ */
+u32 invoices_delete_older(struct invoices *invoices,
+			  enum invoice_status status,
+			  u64 before,
+			  u32 max);
+
 /**
  * invoices_delete_description - Remove description from an invoice
  *
@@ -25,12 +25,26 @@ static void db_log_(struct logger *log UNUSED, enum log_level level UNUSED, cons
 /* Generated stub for bip32_pubkey */
 void bip32_pubkey(struct lightningd *ld UNNEEDED, struct pubkey *pubkey UNNEEDED, u32 index UNNEEDED)
 { fprintf(stderr, "bip32_pubkey called!\n"); abort(); }
+/* Generated stub for channel_add_state_change */
+void channel_add_state_change(struct channel *channel UNNEEDED,
+			      struct timeabs timestamp UNNEEDED,
+			      enum channel_state old_state UNNEEDED,
+			      enum channel_state new_state UNNEEDED,
+			      enum state_change cause UNNEEDED,
+			      const char *message UNNEEDED)
+{ fprintf(stderr, "channel_add_state_change called!\n"); abort(); }
 /* Generated stub for channel_gossip_get_remote_update */
 const struct peer_update *channel_gossip_get_remote_update(const struct channel *channel UNNEEDED)
 { fprintf(stderr, "channel_gossip_get_remote_update called!\n"); abort(); }
 /* Generated stub for channel_gossip_update */
 void channel_gossip_update(struct channel *channel UNNEEDED)
 { fprintf(stderr, "channel_gossip_update called!\n"); abort(); }
+/* Generated stub for channel_index_created */
+void channel_index_created(struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_index_created called!\n"); abort(); }
+/* Generated stub for channel_index_updated */
+void channel_index_updated(struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_index_updated called!\n"); abort(); }
 /* Generated stub for channel_scid_or_local_alias */
 struct short_channel_id channel_scid_or_local_alias(const struct channel *chan UNNEEDED)
 { fprintf(stderr, "channel_scid_or_local_alias called!\n"); abort(); }
@@ -231,6 +245,13 @@ struct peer *new_peer(struct lightningd *ld UNNEEDED, u64 dbid UNNEEDED,
 /* Generated stub for notify_chain_mvt */
 void notify_chain_mvt(struct lightningd *ld UNNEEDED, const struct chain_coin_mvt *mvt UNNEEDED)
 { fprintf(stderr, "notify_chain_mvt called!\n"); abort(); }
+/* Generated stub for notify_db_slow_query */
+void notify_db_slow_query(struct lightningd *ld UNNEEDED,
+			  const char *location UNNEEDED,
+			  const char *query UNNEEDED,
+			  u64 rows UNNEEDED,
+			  struct timerel elapsed UNNEEDED)
+{ fprintf(stderr, "notify_db_slow_query called!\n"); abort(); }
 /* Generated stub for notify_forward_event */
 void notify_forward_event(struct lightningd *ld UNNEEDED,
 			  const struct htlc_in *in UNNEEDED,
@@ -338,6 +359,10 @@ bool wire_sync_write(int fd UNNEEDED, const void *msg TAKES UNNEEDED)
 void plugin_hook_db_sync(struct db *db UNNEEDED)
 {
 }
+bool plugin_hook_db_wanted(struct db *db UNNEEDED)
+{
+	return false;
+}
 
 static struct db *create_test_db(void)
 {
@@ -429,6 +454,297 @@ static bool test_vars(struct lightningd *ld)
 	return true;
 }
 
+static bool test_deferred_commit(struct lightningd *ld)
+{
+	struct db *db = create_test_db();
+	const struct ext_key *bip32_base = NULL;
+	u32 data_version;
+	CHECK(db);
+
+	db_begin_transaction(db);
+	db_migrate(ld, db, bip32_base);
+	db_commit_transaction(db);
+	data_version = db->data_version;
+
+	/* Nothing written: no point deferring. */
+	db_begin_transaction(db);
+	CHECK(db_get_intvar(db, "testvar", 42) == 42);
+	db_commit_transaction_deferred(db);
+	CHECK(!db->in_transaction);
+	CHECK(!db->commit_deferred);
+	CHECK(!db_flush_deferred_commit(db));
+
+	/* Two writes, grouped into one commit. */
+	db_begin_transaction(db);
+	db_set_intvar(db, "testvar", 1);
+	db_commit_transaction_deferred(db);
+	CHECK(!db_in_transaction(db));
+	CHECK(db->commit_deferred);
+
+	db_begin_transaction(db);
+	CHECK(!db->commit_deferred);
+	CHECK(db_get_intvar(db, "testvar", 42) == 1);
+	db_set_intvar(db, "testvar", 2);
+	db_commit_transaction_deferred(db);
+	CHECK(db->data_version == data_version);
+
+	CHECK(db_flush_deferred_commit(db));
+	CHECK(!db->commit_deferred);
+	CHECK(db->data_version == data_version + 1);
+
+	/* A normal commit commits the whole group. */
+	db_begin_transaction(db);
+	db_set_intvar(db, "testvar", 3);
+	db_commit_transaction_deferred(db);
+	db_begin_transaction(db);
+	db_commit_transaction(db);
+	CHECK(!db->commit_deferred);
+	CHECK(db->data_version == data_version + 2);
+
+	db_begin_transaction(db);
+	CHECK(db_get_intvar(db, "testvar", 42) == 3);
+	db_commit_transaction(db);
+
+	tal_free(db);
+	return true;
+}
+
+static struct db_stmt *query_intvar(struct db *db, const char *varname)
+{
+	struct db_stmt *stmt;
+
+	stmt = db_prepare_v2(db, SQL("SELECT intval FROM vars WHERE name = ?"));
+	db_bind_text(stmt, varname);
+	db_query_prepared(stmt);
+	return stmt;
+}
+
+static bool test_stmt_cache(struct lightningd *ld)
+{
+	struct db *db = create_test_db();
+	const struct ext_key *bip32_base = NULL;
+	struct db_stmt *stmt, *stmt2;
+	size_t hits, misses;
+	CHECK(db);
+
+	db_begin_transaction(db);
+	db_migrate(ld, db, bip32_base);
+	db_set_intvar(db, "testvar", 7);
+
+	hits = db->stmt_cache_hits;
+	misses = db->stmt_cache_misses;
+
+	/* First time, we have to prepare it. */
+	stmt = query_intvar(db, "testvar");
+	CHECK(db->stmt_cache_misses == misses + 1);
+	CHECK(db_step(stmt));
+	CHECK(db_col_int(stmt, "intval") == 7);
+
+	/* Same query while the first is still in use: prepared separately */
+	stmt2 = query_intvar(db, "othervar");
+	CHECK(db->stmt_cache_misses == misses + 2);
+	CHECK(!db_step(stmt2));
+	tal_free(stmt2);
+	tal_free(stmt);
+
+	/* Now it comes from the cache, with the new binding. */
+	stmt = query_intvar(db, "testvar");
+	CHECK(db->stmt_cache_hits == hits + 1);
+	CHECK(db->stmt_cache_misses == misses + 2);
+	CHECK(db_step(stmt));
+	CHECK(db_col_int(stmt, "intval") == 7);
+	tal_free(stmt);
+	db_commit_transaction(db);
+
+	tal_free(db);
+	return true;
+}
+
+static size_t slow_queries;
+static void slow_query(struct db *db, const struct db_stmt *stmt)
+{
+	slow_queries++;
+}
+
+static bool test_profile(struct lightningd *ld)
+{
+	struct db *db = create_test_db();
+	const struct ext_key *bip32_base = NULL;
+	struct db_stmt *stmt;
+	struct timerel slow = time_from_sec(0);
+	ssize_t idx;
+	CHECK(db);
+
+	db_begin_transaction(db);
+	db_migrate(ld, db, bip32_base);
+	db_set_intvar(db, "testvar", 7);
+	db_commit_transaction(db);
+
+	/* Off by default */
+	CHECK(!db->profile);
+
+	db->slow_query_fn = slow_query;
+	db_profile_enable(db, true, &slow);
+
+	db_begin_transaction(db);
+	stmt = query_intvar(db, "testvar");
+	idx = db_query_table_index(stmt);
+	CHECK(idx >= 0);
+	CHECK(db_step(stmt));
+	CHECK(db_col_int(stmt, "intval") == 7);
+	CHECK(!db_step(stmt));
+	tal_free(stmt);
+
+	stmt = query_intvar(db, "othervar");
+	CHECK(!db_step(stmt));
+	tal_free(stmt);
+	db_commit_transaction(db);
+
+	CHECK(db->profile->queries[idx].executions == 2);
+	CHECK(db->profile->queries[idx].rows == 1);
+	CHECK(db->profile->queries[idx].bytes_bound
+	      == strlen("testvar") + strlen("othervar"));
+	CHECK(!time_less(db->profile->queries[idx].total,
+			 db->profile->queries[idx].max));
+	CHECK(db->profile->transactions == 1);
+	/* Everything is slower than 0 seconds. */
+	CHECK(slow_queries == 2);
+
+	/* Restarting resets the counters. */
+	db_profile_enable(db, true, NULL);
+	CHECK(db->profile->queries[idx].executions == 0);
+	db_begin_transaction(db);
+	tal_free(query_intvar(db, "testvar"));
+	db_commit_transaction(db);
+	CHECK(db->profile->queries[idx].executions == 1);
+	CHECK(slow_queries == 2);
+
+	db_profile_enable(db, false, NULL);
+	CHECK(!db->profile);
+
+	tal_free(db);
+	return true;
+}
+
+static const char **reported;
+static void report_changes(struct db *db)
+{
+	reported = tal_steal(NULL, db_changes(db));
+}
+
+static bool changes_wanted;
+static bool want_changes(struct db *db)
+{
+	return changes_wanted;
+}
+
+static bool test_changes(struct lightningd *ld)
+{
+	struct db *db = create_test_db();
+	const struct ext_key *bip32_base = NULL;
+	struct db_stmt *stmt;
+	const u8 blob[] = { 0x00, 0xde, 0xad };
+	CHECK(db);
+
+	db_begin_transaction(db);
+	db_migrate(ld, db, bip32_base);
+	db_commit_transaction(db);
+
+	db->report_changes_fn = report_changes;
+	db->changes_wanted_fn = want_changes;
+
+	/* Nobody wants them: we don't even record them. */
+	changes_wanted = false;
+	db_begin_transaction(db);
+	CHECK(!db->changes);
+	db_set_intvar(db, "testvar", 1);
+	CHECK(!db->changes);
+	db_commit_transaction(db);
+	CHECK(!reported);
+
+	/* Recorded as bindings, expanded when reported. */
+	changes_wanted = true;
+	db_begin_transaction(db);
+	stmt = db_prepare_v2(db, SQL("INSERT INTO vars (name, val, intval, blobval) VALUES (?, ?, ?, ?);"));
+	db_bind_text(stmt, "it's");
+	db_bind_null(stmt);
+	db_bind_u64(stmt, -1ULL);
+	db_bind_blob(stmt, blob, sizeof(blob));
+	db_exec_prepared_v2(take(stmt));
+	CHECK(tal_count(db->changes) == 1);
+	db_commit_transaction(db);
+
+	/* Plus the data_version update. */
+	CHECK(tal_count(reported) == 2);
+	CHECK(streq(reported[0], "INSERT INTO vars (name, val, intval, blobval) VALUES ('it''s', NULL, -1, x'00dead');"));
+	reported = tal_free(reported);
+
+	tal_free(db);
+	return true;
+}
+
+static s64 replica_intvar(const char *filename, const char *varname)
+{
+	char *dsn = tal_fmt(tmpctx, "sqlite3://%s", filename);
+	struct db *db = db_open(NULL, dsn, true, db_error,
+				(struct lightningd *)NULL);
+	s64 val;
+
+	db_begin_transaction(db);
+	val = db_get_intvar(db, varname, -1);
+	db_commit_transaction(db);
+	tal_free(db);
+	return val;
+}
+
+static bool test_replica(struct lightningd *ld)
+{
+	struct db *db;
+	const struct ext_key *bip32_base = NULL;
+	char *filename, *backup_filename, *dsn;
+	int fd;
+
+	fd = tmpdir_mkstemp(tmpctx, "ldb-XXXXXX", &filename);
+	CHECK(fd != -1);
+	close(fd);
+	fd = tmpdir_mkstemp(tmpctx, "ldb-backup-XXXXXX", &backup_filename);
+	CHECK(fd != -1);
+	close(fd);
+
+	dsn = tal_fmt(tmpctx, "sqlite3://%s:%s", filename, backup_filename);
+	db = db_open(NULL, dsn, true, db_error, (struct lightningd *)NULL);
+	db->data_version = 0;
+	db->report_changes_fn = NULL;
+
+	db_begin_transaction(db);
+	db_migrate(ld, db, bip32_base);
+	db_commit_transaction(db);
+	db_sync_replica(db);
+	CHECK(replica_intvar(backup_filename, "testvar") == -1);
+
+	/* Committed, but the replica lags... */
+	db_begin_transaction(db);
+	db_set_intvar(db, "testvar", 1);
+	db_commit_transaction(db);
+	db_begin_transaction(db);
+	db_set_intvar(db, "testvar", 2);
+	db_commit_transaction(db);
+	CHECK(replica_intvar(backup_filename, "testvar") == -1);
+
+	/* ... until we ask. */
+	db_sync_replica(db);
+	CHECK(replica_intvar(backup_filename, "testvar") == 2);
+
+	/* It's also caught up when we close. */
+	db_begin_transaction(db);
+	db_set_intvar(db, "testvar", 3);
+	db_commit_transaction(db);
+	tal_free(db);
+	CHECK(replica_intvar(backup_filename, "testvar") == 3);
+
+	return true;
+}
+
 static bool test_manip_columns(void)
 {
 	struct db_stmt *stmt;
@@ -488,7 +804,7 @@ static bool test_manip_columns(void)
 	CHECK(!db_step(stmt));
 	tal_free(stmt);
 	db->dirty = false;
-	db->changes = tal_arr(db, const char *, 0);
+	db->changes = tal_arr(db, struct db_change, 0);
 	db_commit_transaction(db);
 
 	db_begin_transaction(db);
@@ -496,7 +812,7 @@ static bool test_manip_columns(void)
 	stmt = db_prepare_v2(db, SQL("SELECT field1 FROM tablea;"));
 	CHECK_MSG(!db_query_prepared_canfail(stmt), "db_query_prepared must fail");
 	db->dirty = false;
-	db->changes = tal_arr(db, const char *, 0);
+	db->changes = tal_arr(db, struct db_change, 0);
 	db_commit_transaction(db);
 
 	db_begin_transaction(db);
@@ -504,7 +820,7 @@ static bool test_manip_columns(void)
 	stmt = db_prepare_v2(db, SQL("SELECT field1 FROM tableb;"));
 	CHECK_MSG(!db_query_prepared_canfail(stmt), "db_query_prepared must fail");
 	db->dirty = false;
-	db->changes = tal_arr(db, const char *, 0);
+	db->changes = tal_arr(db, struct db_change, 0);
 	db_commit_transaction(db);
 
 	tal_free(db);
@@ -525,6 +841,11 @@ int main(int argc, char *argv[])
 		ok &= test_empty_db_migrate(ld);
 		ok &= test_vars(ld);
 		ok &= test_primitives();
+		ok &= test_deferred_commit(ld);
+		ok &= test_stmt_cache(ld);
+		ok &= test_profile(ld);
+		ok &= test_changes(ld);
+		ok &= test_replica(ld);
 		ok &= test_manip_columns();
 	}
 
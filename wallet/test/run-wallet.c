@@ -121,6 +121,14 @@ const char *check_announce_sigs(const struct channel *channel UNNEEDED,
 const char *cmd_id_from_close_command(const tal_t *ctx UNNEEDED,
 				      struct lightningd *ld UNNEEDED, struct channel *channel UNNEEDED)
 { fprintf(stderr, "cmd_id_from_close_command called!\n"); abort(); }
+/* Generated stub for command_batched_ */
+struct command_result *command_batched_(struct command *cmd UNNEEDED,
+					const char *fieldname UNNEEDED,
+					u32 (*batch)(struct command *cmd,
+						     u32 max,
+						     void *arg) UNNEEDED,
+					void *arg UNNEEDED)
+{ fprintf(stderr, "command_batched_ called!\n"); abort(); }
 /* Generated stub for command_check_done */
 struct command_result *command_check_done(struct command *cmd)
 
@@ -209,9 +217,6 @@ void derive_channel_id(struct channel_id *channel_id UNNEEDED,
 /* Generated stub for dev_disconnect_permanent */
 bool dev_disconnect_permanent(struct lightningd *ld UNNEEDED)
 { fprintf(stderr, "dev_disconnect_permanent called!\n"); abort(); }
-/* Generated stub for ecdh */
-void ecdh(const struct pubkey *point UNNEEDED, struct secret *ss UNNEEDED)
-{ fprintf(stderr, "ecdh called!\n"); abort(); }
 /* Generated stub for encode_scriptpubkey_to_addr */
 char *encode_scriptpubkey_to_addr(const tal_t *ctx UNNEEDED,
 				  const struct chainparams *chainparams UNNEEDED,
@@ -261,6 +266,9 @@ bool fromwire_channeld_dev_memleak_reply(const void *p UNNEEDED, bool *leak UNNE
 /* Generated stub for fromwire_channeld_got_commitsig */
 bool fromwire_channeld_got_commitsig(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, u64 *commitnum UNNEEDED, struct fee_states **fee_states UNNEEDED, struct height_states **blockheight_states UNNEEDED, struct bitcoin_signature *signature UNNEEDED, struct bitcoin_signature **htlc_signature UNNEEDED, struct added_htlc **added UNNEEDED, struct fulfilled_htlc **fulfilled UNNEEDED, struct failed_htlc ***failed UNNEEDED, struct changed_htlc **changed UNNEEDED, struct bitcoin_tx **tx UNNEEDED, struct commitsig ***inflight_commitsigs UNNEEDED)
 { fprintf(stderr, "fromwire_channeld_got_commitsig called!\n"); abort(); }
+/* Generated stub for fromwire_channeld_got_htlc_preimage */
+bool fromwire_channeld_got_htlc_preimage(const void *p UNNEEDED, u64 *id UNNEEDED, struct preimage *preimage UNNEEDED)
+{ fprintf(stderr, "fromwire_channeld_got_htlc_preimage called!\n"); abort(); }
 /* Generated stub for fromwire_channeld_got_revoke */
 bool fromwire_channeld_got_revoke(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, u64 *revokenum UNNEEDED, struct secret *per_commitment_secret UNNEEDED, struct pubkey *next_per_commit_point UNNEEDED, struct fee_states **fee_states UNNEEDED, struct height_states **blockheight_states UNNEEDED, struct changed_htlc **changed UNNEEDED, struct penalty_base **pbase UNNEEDED, struct bitcoin_tx **penalty_tx UNNEEDED)
 { fprintf(stderr, "fromwire_channeld_got_revoke called!\n"); abort(); }
@@ -549,6 +557,9 @@ struct json_stream *json_stream_fail(struct command *cmd UNNEEDED,
 /* Generated stub for json_stream_success */
 struct json_stream *json_stream_success(struct command *cmd UNNEEDED)
 { fprintf(stderr, "json_stream_success called!\n"); abort(); }
+/* Generated stub for json_stream_wants */
+bool json_stream_wants(const struct json_stream *js UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_stream_wants called!\n"); abort(); }
 /* Generated stub for json_to_channel_id */
 bool json_to_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
 			struct channel_id *cid UNNEEDED)
@@ -672,6 +683,13 @@ void notify_connect(struct lightningd *ld UNNEEDED,
 		    bool incoming UNNEEDED,
 		    const struct wireaddr_internal *addr UNNEEDED)
 { fprintf(stderr, "notify_connect called!\n"); abort(); }
+/* Generated stub for notify_db_slow_query */
+void notify_db_slow_query(struct lightningd *ld UNNEEDED,
+			  const char *location UNNEEDED,
+			  const char *query UNNEEDED,
+			  u64 rows UNNEEDED,
+			  struct timerel elapsed UNNEEDED)
+{ fprintf(stderr, "notify_db_slow_query called!\n"); abort(); }
 /* Generated stub for notify_disconnect */
 void notify_disconnect(struct lightningd *ld UNNEEDED, struct node_id *nodeid UNNEEDED)
 { fprintf(stderr, "notify_disconnect called!\n"); abort(); }
@@ -897,6 +915,9 @@ bool plugin_hook_call_(struct lightningd *ld UNNEEDED,
 		       const char *cmd_id TAKES UNNEEDED,
 		       tal_t *cb_arg STEALS UNNEEDED)
 { fprintf(stderr, "plugin_hook_call_ called!\n"); abort(); }
+/* Generated stub for plugin_hook_db_need_sync */
+void plugin_hook_db_need_sync(struct lightningd *ld UNNEEDED)
+{ fprintf(stderr, "plugin_hook_db_need_sync called!\n"); abort(); }
 /* Generated stub for process_onionpacket */
 struct route_step *process_onionpacket(
 	const tal_t * ctx UNNEEDED,
@@ -965,11 +986,6 @@ void subd_send_fd(struct subd *sd UNNEEDED, int fd UNNEEDED)
 /* Generated stub for subd_send_msg */
 void subd_send_msg(struct subd *sd UNNEEDED, const u8 *msg_out UNNEEDED)
 { fprintf(stderr, "subd_send_msg called!\n"); abort(); }
-/* Generated stub for subkey_from_hmac */
-void subkey_from_hmac(const char *prefix UNNEEDED,
-		      const struct secret *base UNNEEDED,
-		      struct secret *key UNNEEDED)
-{ fprintf(stderr, "subkey_from_hmac called!\n"); abort(); }
 /* Generated stub for tlv_hsmd_dev_preinit_tlvs_new */
 struct tlv_hsmd_dev_preinit_tlvs *tlv_hsmd_dev_preinit_tlvs_new(const tal_t *ctx UNNEEDED)
 { fprintf(stderr, "tlv_hsmd_dev_preinit_tlvs_new called!\n"); abort(); }
@@ -1205,6 +1221,10 @@ u8 *wire_sync_read(const tal_t *ctx UNNEEDED, int fd UNNEEDED)
 void plugin_hook_db_sync(struct db *db UNNEEDED)
 {
 }
+bool plugin_hook_db_wanted(struct db *db UNNEEDED)
+{
+	return false;
+}
 bool fromwire_hsmd_get_channel_basepoints_reply(const void *p UNNEEDED,
 					       struct basepoints *basepoints,
 					       struct pubkey *funding_pubkey)
@@ -1703,7 +1723,8 @@ static struct channel *wallet_channel_load(struct wallet *w, const u64 dbid)
 static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 {
 	struct wallet *w = create_test_wallet(ld, ctx);
-	struct channel c1, *c2 = tal(w, struct channel);
+	struct channel c1, *c2 = tal(w, struct channel), *c3;
+	struct channel_stats stats;
 	struct wireaddr_internal addr;
 	struct peer *p;
 	struct channel_info *ci = &c1.channel_info;
@@ -1717,6 +1738,7 @@ static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 	secp256k1_ecdsa_signature *bitcoin_sig1 = tal(w, secp256k1_ecdsa_signature);
 	secp256k1_ecdsa_signature *node_sig2, *bitcoin_sig2;
 	u32 feerate, blockheight;
+	u64 updated_index;
 	bool load;
 	const struct channel_type *type = channel_type_static_remotekey(w);
 
@@ -1769,6 +1791,7 @@ static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 	c1.type = type;
 
 	db_begin_transaction(w->db);
+	load_indexes(w->db, ld->indexes);
 	CHECK(!wallet_err);
 
 	wallet_channel_insert(w, &c1);
@@ -1783,6 +1806,9 @@ static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 	CHECK_MSG(channelseq(&c1, c2), "Compare loaded with saved (v1)");
 	tal_free(c2);
 
+	/* Nothing listpeerchannels shows has changed. */
+	CHECK(c1.updated_index == 0);
+
 	/* We just inserted them into an empty DB so this must be 1 */
 	CHECK(c1.dbid == 1);
 	CHECK(c1.peer->dbid == 1);
@@ -1800,6 +1826,10 @@ static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 	CHECK_MSG(channelseq(&c1, c2), "Compare loaded with saved (v2)");
 	tal_free(c2);
 
+	/* The scid shows, so that's an update */
+	CHECK(c1.updated_index != 0);
+	updated_index = c1.updated_index;
+
 	/* Updates should not result in new ids */
 	CHECK(c1.dbid == 1);
 	CHECK(c1.peer->dbid == 1);
@@ -1815,6 +1845,9 @@ static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 	CHECK_MSG(channelseq(&c1, c2), "Compare loaded with saved (v3)");
 	tal_free(c2);
 
+	/* The last commitment sent doesn't show, so that isn't */
+	CHECK(c1.updated_index == updated_index);
+
 	/* Updates should not result in new ids */
 	CHECK(c1.dbid == 1);
 	CHECK(c1.peer->dbid == 1);
@@ -1855,6 +1888,33 @@ static bool test_channel_crud(struct lightningd *ld, const tal_t *ctx)
 	wallet_remote_ann_sigs_clear(w, &c1);
 	CHECK(!wallet_remote_ann_sigs_load(w, &c1, node_sig2, bitcoin_sig2));
 
+	/* Statistics are kept in memory until the channel is saved (the
+	 * flush timer is allocated off the channel, so use a tal copy). */
+	c3 = tal_dup(w, struct channel, &c1);
+	wallet_channel_stats_incr_in_offered(w, c3, AMOUNT_MSAT(1000));
+	wallet_channel_stats_incr_in_fulfilled(w, c3, AMOUNT_MSAT(1000));
+	wallet_channel_stats_incr_out_offered(w, c3, AMOUNT_MSAT(900));
+	CHECK(c3->stats_flush_timer);
+	CHECK(c3->stats.in_payments_offered == 1);
+	CHECK(c3->stats.in_payments_fulfilled == 1);
+	CHECK(c3->stats.out_payments_offered == 1);
+	CHECK(c3->stats.out_payments_fulfilled == 0);
+	CHECK(amount_msat_eq(c3->stats.out_msatoshi_offered, AMOUNT_MSAT(900)));
+	stats = c3->stats;
+
+	wallet_channel_save(w, c3);
+	CHECK_MSG(!wallet_err,
+		  tal_fmt(w, "Flush stats into DB: %s", wallet_err));
+	CHECK(!c3->stats_flush_timer);
+	CHECK(c3->stats_unflushed.in_payments_offered == 0);
+	CHECK(memeq(&c3->stats, sizeof(c3->stats), &stats, sizeof(stats)));
+
+	/* And they come back from the db when the channel is reloaded */
+	CHECK_MSG(c2 = wallet_channel_load(w, c1.dbid), tal_fmt(w, "Load from DB"));
+	CHECK(amount_msat_eq(c2->stats.in_msatoshi_fulfilled, AMOUNT_MSAT(1000)));
+	CHECK(amount_msat_eq(c2->stats.out_msatoshi_offered, AMOUNT_MSAT(900)));
+	CHECK(memeq(&c2->stats, sizeof(c2->stats), &stats, sizeof(stats)));
+
 	db_commit_transaction(w->db);
 	CHECK(!wallet_err);
 
@@ -2085,7 +2145,7 @@ static bool test_htlc_crud(struct lightningd *ld, const tal_t *ctx)
 	struct htlc_in in, *hin;
 	struct htlc_out out, *hout;
 	struct preimage payment_key;
-	struct channel *chan = tal(ctx, struct channel);
+	struct channel *chan = tal(ctx, struct channel), **chans;
 	struct peer *peer = talz(ctx, struct peer);
 	struct wallet *w = create_test_wallet(ld, ctx);
 	struct htlc_in_map *htlcs_in = tal(ctx, struct htlc_in_map), *rem;
@@ -2094,8 +2154,9 @@ static bool test_htlc_crud(struct lightningd *ld, const tal_t *ctx)
 
 	/* Make sure we have our references correct */
 	db_begin_transaction(w->db);
-	char *query = SQL("INSERT INTO channels (id) VALUES (1);");
+	char *query = SQL("INSERT INTO channels (id, state) VALUES (1, ?);");
 	stmt = db_prepare_v2(w->db, query);
+	db_bind_int(stmt, CHANNELD_NORMAL);
 	db_exec_prepared_v2(stmt);
 	tal_free(stmt);
 	db_commit_transaction(w->db);
@@ -2161,12 +2222,14 @@ static bool test_htlc_crud(struct lightningd *ld, const tal_t *ctx)
 	db_begin_transaction(w->db);
 	CHECK(!wallet_err);
 
-	CHECK_MSG(wallet_htlcs_load_in_for_channel(w, chan, htlcs_in),
+	chans = tal_arr(ctx, struct channel *, 1);
+	chans[0] = chan;
+	CHECK_MSG(wallet_htlcs_load_in(w, chans, htlcs_in),
 		  "Failed loading in HTLCs");
 	/* Freed by htlcs_resubmit */
 	rem = tal(NULL, struct htlc_in_map);
 	htlc_in_map_copy(rem, htlcs_in);
-	CHECK_MSG(wallet_htlcs_load_out_for_channel(w, chan, htlcs_out, rem),
+	CHECK_MSG(wallet_htlcs_load_out(w, chans, htlcs_out, rem),
 		  "Failed loading out HTLCs");
 	db_commit_transaction(w->db);
 
@@ -2187,6 +2250,100 @@ static bool test_htlc_crud(struct lightningd *ld, const tal_t *ctx)
 	return true;
 }
 
+/* A wallet with many channels: at startup we load all their HTLCs at once */
+#define NUM_BULK_CHANNELS 1000
+static bool test_htlc_bulk_load(struct lightningd *ld, const tal_t *ctx)
+{
+	struct db_stmt *stmt;
+	struct wallet *w = create_test_wallet(ld, ctx);
+	struct peer *peer = talz(ctx, struct peer);
+	tal_t *chanctx = tal(ctx, char);
+	struct channel **chans = tal_arr(ctx, struct channel *, NUM_BULK_CHANNELS);
+	struct channel closed;
+	struct htlc_in_map *htlcs_in = tal(ctx, struct htlc_in_map), *rem;
+	struct htlc_out_map *htlcs_out = tal(ctx, struct htlc_out_map);
+	struct timemono start;
+
+	db_begin_transaction(w->db);
+	for (size_t i = 0; i <= NUM_BULK_CHANNELS; i++) {
+		struct channel *chan;
+		struct htlc_in in;
+		struct htlc_out out;
+
+		/* The last one is closed, so its HTLCs must not be loaded. */
+		if (i == NUM_BULK_CHANNELS)
+			chan = &closed;
+		else
+			chan = chans[i] = talz(chanctx, struct channel);
+		chan->dbid = i + 1;
+		chan->peer = peer;
+		chan->next_index[LOCAL] = chan->next_index[REMOTE] = 1;
+
+		stmt = db_prepare_v2(w->db,
+				     SQL("INSERT INTO channels (id, state) VALUES (?, ?);"));
+		db_bind_u64(stmt, chan->dbid);
+		db_bind_int(stmt, chan == &closed ? CLOSED : CHANNELD_NORMAL);
+		db_exec_prepared_v2(take(stmt));
+
+		memset(&in, 0, sizeof(in));
+		memset(&in.payment_hash, 'A', sizeof(in.payment_hash));
+		in.key.id = i;
+		in.key.channel = chan;
+		in.msat = AMOUNT_MSAT(42);
+		in.hstate = RCVD_ADD_COMMIT;
+		wallet_htlc_save_in(w, chan, &in);
+
+		memset(&out, 0, sizeof(out));
+		memset(&out.payment_hash, 'B', sizeof(out.payment_hash));
+		out.key.id = i;
+		out.key.channel = chan;
+		out.msat = AMOUNT_MSAT(41);
+		out.hstate = SENT_ADD_HTLC;
+		out.am_origin = true;
+		wallet_htlc_save_out(w, chan, &out);
+	}
+	db_commit_transaction(w->db);
+	CHECK(!wallet_err);
+
+	htlc_in_map_init(htlcs_in);
+	htlc_out_map_init(htlcs_out);
+
+	start = time_mono();
+	db_begin_transaction(w->db);
+	CHECK_MSG(wallet_htlcs_load_in(w, chans, htlcs_in),
+		  "Failed loading in HTLCs");
+	rem = tal(ctx, struct htlc_in_map);
+	htlc_in_map_copy(rem, htlcs_in);
+	CHECK_MSG(wallet_htlcs_load_out(w, chans, htlcs_out, rem),
+		  "Failed loading out HTLCs");
+	db_commit_transaction(w->db);
+	CHECK(!wallet_err);
+
+	/* Two set-based queries, rather than two per channel: this should
+	 * be nowhere near this slow, even under valgrind. */
+	CHECK_MSG(time_less(timemono_since(start), time_from_sec(60)),
+		  "Loading HTLCs was too slow");
+
+	CHECK(htlc_in_map_count(htlcs_in) == NUM_BULK_CHANNELS);
+	CHECK(htlc_out_map_count(htlcs_out) == NUM_BULK_CHANNELS);
+	for (size_t i = 0; i < NUM_BULK_CHANNELS; i++) {
+		struct htlc_key key;
+		struct htlc_in *hin;
+		struct htlc_out *hout;
+
+		key.channel = chans[i];
+		key.id = i;
+		hin = htlc_in_map_get(htlcs_in, &key);
+		hout = htlc_out_map_get(htlcs_out, &key);
+		CHECK(hin && tal_parent(hin) == chans[i]);
+		CHECK(hout && tal_parent(hout) == chans[i]);
+	}
+
+	/* Frees the HTLCs before the maps they're in. */
+	tal_free(chanctx);
+	return true;
+}
+
 static bool test_payment_crud(struct lightningd *ld, const tal_t *ctx)
 {
 	struct wallet_payment *t, *t2;
@@ -2276,6 +2433,8 @@ int main(int argc, const char *argv[])
 	ld->peers_by_dbid = tal(ld, struct peer_dbid_map);
 	peer_dbid_map_init(ld->peers_by_dbid);
 	ld->rr_counter = 0;
+	ld->timers = tal(ld, struct timers);
+	timers_init(ld->timers, time_mono());
 	node_id_from_hexstr("02a1633cafcc01ebfb6d78e39f687a1f0995c62fc95f51ead10a02ee0be551b5dc", 66, &ld->id);
 	/* Accessed in peer destructor sanity check */
 	ld->htlcs_in = tal(ld, struct htlc_in_map);
@@ -2293,6 +2452,7 @@ int main(int argc, const char *argv[])
 		ok &= test_channel_inflight_crud(ld, tmpctx);
 		ok &= test_wallet_outputs(ld, tmpctx);
 		ok &= test_htlc_crud(ld, tmpctx);
+		ok &= test_htlc_bulk_load(ld, tmpctx);
 		ok &= test_payment_crud(ld, tmpctx);
 		ok &= test_wallet_payment_status_enum();
 	}
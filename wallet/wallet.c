@@ -1,6 +1,7 @@
 #include "config.h"
 #include <bitcoin/script.h>
 #include <ccan/array_size/array_size.h>
+#include <ccan/asort/asort.h>
 #include <ccan/cast/cast.h>
 #include <ccan/mem/mem.h>
 #include <ccan/tal/str/str.h>
@@ -8,6 +9,7 @@
 #include <common/blockheight_states.h>
 #include <common/fee_states.h>
 #include <common/onionreply.h>
+#include <common/timeout.h>
 #include <common/trace.h>
 #include <db/bindings.h>
 #include <db/common.h>
@@ -37,6 +39,9 @@
 /* 12 hours is usually enough reservation time */
 #define RESERVATION_INC (6 * 12)
 
+/* Longest we keep HTLC statistics for a channel only in memory */
+#define CHANNEL_STATS_FLUSH_SECS 60
+
 /* Possible channel state */
 enum channel_state_bucket {
 	IN_OFFERED = 0,
@@ -1322,6 +1327,43 @@ void wallet_channel_clear_inflights(struct wallet *w,
 		tal_free(inflight);
 }
 
+static int channel_dbid_cmp(struct channel *const *a,
+			    struct channel *const *b,
+			    void *unused)
+{
+	if ((*a)->dbid < (*b)->dbid)
+		return -1;
+	return (*a)->dbid > (*b)->dbid;
+}
+
+/* When loading in bulk, we join rows to channels by dbid in memory. */
+static struct channel **channels_sorted_by_dbid(const tal_t *ctx,
+						struct channel **chans)
+{
+	struct channel **sorted = tal_dup_talarr(ctx, struct channel *, chans);
+	asort(sorted, tal_count(sorted), channel_dbid_cmp, NULL);
+	return sorted;
+}
+
+static struct channel *channel_in_sorted(struct wallet *w,
+					 struct channel **sorted,
+					 u64 dbid)
+{
+	size_t lo = 0, hi = tal_count(sorted);
+
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		if (sorted[mid]->dbid == dbid)
+			return sorted[mid];
+		if (sorted[mid]->dbid < dbid)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	db_fatal(w->db, "No loaded channel with dbid %"PRIu64, dbid);
+	return NULL;
+}
+
 static struct channel_inflight *
 wallet_stmt2inflight(struct wallet *w, struct db_stmt *stmt,
 		     struct channel *chan)
@@ -1413,14 +1455,17 @@ wallet_stmt2inflight(struct wallet *w, struct db_stmt *stmt,
 	return inflight;
 }
 
-static bool wallet_channel_load_inflights(struct wallet *w,
-					  struct channel *chan)
+static bool wallet_channels_load_inflights(struct wallet *w,
+					   struct channel **chans)
 {
 	bool ok = true;
 	struct db_stmt *stmt;
+	struct channel **sorted = channels_sorted_by_dbid(tmpctx, chans);
 
+	/* Per channel, these must be loaded in feerate order. */
 	stmt = db_prepare_v2(w->db, SQL("SELECT"
-					"  funding_tx_id"
+					"  channel_id"
+					", funding_tx_id"
 					", funding_tx_outnum"
 					", funding_feerate"
 					", funding_satoshi"
@@ -1440,14 +1485,19 @@ static bool wallet_channel_load_inflights(struct wallet *w,
 					", i_am_initiator"
 					", force_sign_first"
 					" FROM channel_funding_inflights"
-					" WHERE channel_id = ?"
-					" ORDER BY funding_feerate"));
+					" WHERE channel_id IN"
+					"  (SELECT id FROM channels WHERE state != ?)"
+					" ORDER BY channel_id, funding_feerate"));
 
-	db_bind_u64(stmt, chan->dbid);
+	db_bind_int(stmt, CLOSED);
 	db_query_prepared(stmt);
 
 	while (db_step(stmt)) {
 		struct channel_inflight *inflight;
+		struct channel *chan;
+
+		chan = channel_in_sorted(w, sorted,
+					 db_col_u64(stmt, "channel_id"));
 		inflight = wallet_stmt2inflight(w, stmt, chan);
 		if (!inflight) {
 			ok = false;
@@ -1459,6 +1509,41 @@ static bool wallet_channel_load_inflights(struct wallet *w,
 	return ok;
 }
 
+static void wallet_channels_load_state_changes(struct wallet *w,
+					       struct channel **chans)
+{
+	struct db_stmt *stmt;
+	struct channel **sorted = channels_sorted_by_dbid(tmpctx, chans);
+
+	stmt = db_prepare_v2(w->db, SQL("SELECT"
+					"  channel_id"
+					", timestamp"
+					", old_state"
+					", new_state"
+					", cause"
+					", message"
+					" FROM channel_state_changes"
+					" WHERE channel_id IN"
+					"  (SELECT id FROM channels WHERE state != ?)"
+					" ORDER BY channel_id, timestamp ASC;"));
+	db_bind_int(stmt, CLOSED);
+	db_query_prepared(stmt);
+
+	while (db_step(stmt)) {
+		struct channel *chan;
+
+		chan = channel_in_sorted(w, sorted,
+					 db_col_u64(stmt, "channel_id"));
+		channel_add_state_change(chan,
+					 db_col_timeabs(stmt, "timestamp"),
+					 db_col_int(stmt, "old_state"),
+					 db_col_int(stmt, "new_state"),
+					 state_change_in_db(db_col_int(stmt, "cause")),
+					 db_col_strdup(tmpctx, stmt, "message"));
+	}
+	tal_free(stmt);
+}
+
 static bool wallet_channel_config_load(struct wallet *w, const u64 id,
 				       struct channel_config *cc)
 {
@@ -1501,6 +1586,31 @@ static struct short_channel_id *db_col_optional_scid(const tal_t *ctx,
 	return scid;
 }
 
+static void db_col_channel_stats(struct db_stmt *stmt,
+				 struct channel_stats *stats)
+{
+	stats->in_payments_offered
+		= db_col_int_or_default(stmt, "in_payments_offered", 0);
+	stats->in_payments_fulfilled
+		= db_col_int_or_default(stmt, "in_payments_fulfilled", 0);
+	db_col_amount_msat_or_default(stmt, "in_msatoshi_offered",
+				      &stats->in_msatoshi_offered,
+				      AMOUNT_MSAT(0));
+	db_col_amount_msat_or_default(stmt, "in_msatoshi_fulfilled",
+				      &stats->in_msatoshi_fulfilled,
+				      AMOUNT_MSAT(0));
+	stats->out_payments_offered
+		= db_col_int_or_default(stmt, "out_payments_offered", 0);
+	stats->out_payments_fulfilled
+		= db_col_int_or_default(stmt, "out_payments_fulfilled", 0);
+	db_col_amount_msat_or_default(stmt, "out_msatoshi_offered",
+				      &stats->out_msatoshi_offered,
+				      AMOUNT_MSAT(0));
+	db_col_amount_msat_or_default(stmt, "out_msatoshi_fulfilled",
+				      &stats->out_msatoshi_fulfilled,
+				      AMOUNT_MSAT(0));
+}
+
 /**
  * wallet_stmt2channel - Helper to populate a wallet_channel from a `db_stmt`
  */
@@ -1781,11 +1891,10 @@ static struct channel *wallet_stmt2channel(struct wallet *w, struct db_stmt *stm
 			   remote_update,
 			   db_col_u64(stmt, "last_stable_connection"));
 
-	if (!wallet_channel_load_inflights(w, chan)) {
-		tal_free(chan);
-		return NULL;
-	}
-
+	/* Nothing unflushed yet, so this is the total */
+	db_col_channel_stats(stmt, &chan->stats);
+	chan->created_index = db_col_u64(stmt, "created_index");
+	channel_index_loaded(chan);
 	return chan;
 }
 
@@ -1894,7 +2003,7 @@ static bool wallet_channels_load_active(struct wallet *w)
 {
 	bool ok = true;
 	struct db_stmt *stmt;
-	int count = 0;
+	struct channel **chans = tal_arr(tmpctx, struct channel *, 0);
 
 	/* We load all channels */
 	stmt = db_prepare_v2(w->db, SQL("SELECT"
@@ -1973,6 +2082,15 @@ static bool wallet_channels_load_active(struct wallet *w)
 					", remote_htlc_minimum_msat"
 					", remote_htlc_maximum_msat"
 					", last_stable_connection"
+					", in_payments_offered"
+					", in_payments_fulfilled"
+					", in_msatoshi_offered"
+					", in_msatoshi_fulfilled"
+					", out_payments_offered"
+					", out_payments_fulfilled"
+					", out_msatoshi_offered"
+					", out_msatoshi_fulfilled"
+					", created_index"
 					" FROM channels"
                                         " WHERE state != ?;")); //? 0
 	db_bind_int(stmt, CLOSED);
@@ -1984,10 +2102,16 @@ static bool wallet_channels_load_active(struct wallet *w)
 			ok = false;
 			break;
 		}
-		count++;
+		tal_arr_expand(&chans, c);
 	}
-	log_debug(w->log, "Loaded %d channels from DB", count);
+	log_debug(w->log, "Loaded %zu channels from DB", tal_count(chans));
 	tal_free(stmt);
+
+	/* Then all their inflights and state changes at once */
+	if (ok)
+		ok = wallet_channels_load_inflights(w, chans);
+	if (ok)
+		wallet_channels_load_state_changes(w, chans);
 	return ok;
 }
 
@@ -2008,117 +2132,119 @@ static enum channel_state_bucket get_state_channel_db(const char *dir, const cha
 	return channel_state;
 }
 
+static void stats_flush_timeout(struct channel *chan)
+{
+	chan->stats_flush_timer = NULL;
+	wallet_channel_stats_flush(chan->peer->ld->wallet, chan);
+}
+
+static void stats_incr(u64 *payments, struct amount_msat *total,
+		       struct amount_msat msat)
+{
+	(*payments)++;
+	if (!amount_msat_add(total, *total, msat))
+		fatal("Channel stats overflow adding %s",
+		      fmt_amount_msat(tmpctx, msat));
+}
+
 static
 void wallet_channel_stats_incr_x(struct wallet *w,
 				 char const *dir,
 				 char const *typ,
-				 u64 cdbid,
+				 struct channel *chan,
 				 struct amount_msat msat)
 {
-	struct db_stmt *stmt;
-	const char *query = NULL;
-
-	switch (get_state_channel_db(dir, typ)) {
-	case IN_OFFERED:
-		query = SQL("UPDATE channels"
-			    "   SET in_payments_offered = COALESCE(in_payments_offered, 0) + 1"
-			    "     , in_msatoshi_offered = COALESCE(in_msatoshi_offered, 0) + ?"
-			    " WHERE id = ?;");
-		break;
-	case IN_FULLFILLED:
-		query = SQL("UPDATE channels"
-			    "   SET in_payments_fulfilled = COALESCE(in_payments_fulfilled, 0) + 1"
-			    "     , in_msatoshi_fulfilled = COALESCE(in_msatoshi_fulfilled, 0) + ?"
-			    " WHERE id = ?;");
-		break;
-	case OUT_OFFERED:
-		query = SQL("UPDATE channels"
-			    "   SET out_payments_offered = COALESCE(out_payments_offered, 0) + 1"
-			    "     , out_msatoshi_offered = COALESCE(out_msatoshi_offered, 0) + ?"
-			    " WHERE id = ?;");
-		break;
-	case OUT_FULLFILLED:
-		query = SQL("UPDATE channels"
-			    "   SET out_payments_fulfilled = COALESCE(out_payments_fulfilled, 0) + 1"
-			    "     , out_msatoshi_fulfilled = COALESCE(out_msatoshi_fulfilled, 0) + ?"
-			    " WHERE id = ?;");
-		break;
-	}
-
-	// Sanity check!
-	if (!query)
-		fatal("Unknown channel state key (direction %s, type %s)", dir, typ);
+	struct channel_stats *stats[] = { &chan->stats_unflushed, &chan->stats };
 
-	stmt = db_prepare_v2(w->db, query);
-	db_bind_amount_msat(stmt, &msat);
-	db_bind_u64(stmt, cdbid);
+	for (size_t i = 0; i < ARRAY_SIZE(stats); i++) {
+		switch (get_state_channel_db(dir, typ)) {
+		case IN_OFFERED:
+			stats_incr(&stats[i]->in_payments_offered,
+				   &stats[i]->in_msatoshi_offered, msat);
+			break;
+		case IN_FULLFILLED:
+			stats_incr(&stats[i]->in_payments_fulfilled,
+				   &stats[i]->in_msatoshi_fulfilled, msat);
+			break;
+		case OUT_OFFERED:
+			stats_incr(&stats[i]->out_payments_offered,
+				   &stats[i]->out_msatoshi_offered, msat);
+			break;
+		case OUT_FULLFILLED:
+			stats_incr(&stats[i]->out_payments_fulfilled,
+				   &stats[i]->out_msatoshi_fulfilled, msat);
+			break;
+		}
+	}
 
-	db_exec_prepared_v2(take(stmt));
+	/* Usually wallet_channel_save() beats this to it. */
+	if (!chan->stats_flush_timer)
+		chan->stats_flush_timer
+			= new_reltimer(w->ld->timers, chan,
+				       time_from_sec(CHANNEL_STATS_FLUSH_SECS),
+				       stats_flush_timeout, chan);
 }
-void wallet_channel_stats_incr_in_offered(struct wallet *w, u64 id,
+void wallet_channel_stats_incr_in_offered(struct wallet *w,
+					  struct channel *chan,
 					  struct amount_msat m)
 {
-	wallet_channel_stats_incr_x(w, "in", "offered", id, m);
+	wallet_channel_stats_incr_x(w, "in", "offered", chan, m);
 }
-void wallet_channel_stats_incr_in_fulfilled(struct wallet *w, u64 id,
+void wallet_channel_stats_incr_in_fulfilled(struct wallet *w,
+					    struct channel *chan,
 					    struct amount_msat m)
 {
-	wallet_channel_stats_incr_x(w, "in", "fulfilled", id, m);
+	wallet_channel_stats_incr_x(w, "in", "fulfilled", chan, m);
 }
-void wallet_channel_stats_incr_out_offered(struct wallet *w, u64 id,
-					    struct amount_msat m)
+void wallet_channel_stats_incr_out_offered(struct wallet *w,
+					   struct channel *chan,
+					   struct amount_msat m)
 {
-	wallet_channel_stats_incr_x(w, "out", "offered", id, m);
+	wallet_channel_stats_incr_x(w, "out", "offered", chan, m);
 }
-void wallet_channel_stats_incr_out_fulfilled(struct wallet *w, u64 id,
-					    struct amount_msat m)
+void wallet_channel_stats_incr_out_fulfilled(struct wallet *w,
+					     struct channel *chan,
+					     struct amount_msat m)
 {
-	wallet_channel_stats_incr_x(w, "out", "fulfilled", id, m);
+	wallet_channel_stats_incr_x(w, "out", "fulfilled", chan, m);
 }
 
-void wallet_channel_stats_load(struct wallet *w,
-			       u64 id,
-			       struct channel_stats *stats)
+void wallet_channel_stats_flush(struct wallet *w, struct channel *chan)
 {
 	struct db_stmt *stmt;
-	int res;
-	stmt = db_prepare_v2(w->db, SQL(
-				     "SELECT"
-				     "   in_payments_offered,  in_payments_fulfilled"
-				     ",  in_msatoshi_offered,  in_msatoshi_fulfilled"
-				     ", out_payments_offered, out_payments_fulfilled"
-				     ", out_msatoshi_offered, out_msatoshi_fulfilled"
-				     "  FROM channels"
-				     " WHERE id = ?"));
-	db_bind_u64(stmt, id);
-	db_query_prepared(stmt);
+	const struct channel_stats *stats = &chan->stats_unflushed;
 
-	res = db_step(stmt);
+	chan->stats_flush_timer = tal_free(chan->stats_flush_timer);
 
-	/* This must succeed, since we know the channel exists */
-	assert(res);
+	/* Fulfilled implies offered, so this covers everything. */
+	if (stats->in_payments_offered == 0
+	    && stats->out_payments_offered == 0
+	    && stats->in_payments_fulfilled == 0
+	    && stats->out_payments_fulfilled == 0)
+		return;
 
-	stats->in_payments_offered
-		= db_col_int_or_default(stmt, "in_payments_offered", 0);
-	stats->in_payments_fulfilled
-		= db_col_int_or_default(stmt, "in_payments_fulfilled", 0);
-	db_col_amount_msat_or_default(stmt, "in_msatoshi_offered",
-				      &stats->in_msatoshi_offered,
-				      AMOUNT_MSAT(0));
-	db_col_amount_msat_or_default(stmt, "in_msatoshi_fulfilled",
-				      &stats->in_msatoshi_fulfilled,
-				      AMOUNT_MSAT(0));
-	stats->out_payments_offered
-		= db_col_int_or_default(stmt, "out_payments_offered", 0);
-	stats->out_payments_fulfilled
-		= db_col_int_or_default(stmt, "out_payments_fulfilled", 0);
-	db_col_amount_msat_or_default(stmt, "out_msatoshi_offered",
-				      &stats->out_msatoshi_offered,
-				      AMOUNT_MSAT(0));
-	db_col_amount_msat_or_default(stmt, "out_msatoshi_fulfilled",
-				      &stats->out_msatoshi_fulfilled,
-				      AMOUNT_MSAT(0));
-	tal_free(stmt);
+	stmt = db_prepare_v2(w->db, SQL("UPDATE channels"
+					"   SET in_payments_offered = COALESCE(in_payments_offered, 0) + ?"
+					"     , in_payments_fulfilled = COALESCE(in_payments_fulfilled, 0) + ?"
+					"     , in_msatoshi_offered = COALESCE(in_msatoshi_offered, 0) + ?"
+					"     , in_msatoshi_fulfilled = COALESCE(in_msatoshi_fulfilled, 0) + ?"
+					"     , out_payments_offered = COALESCE(out_payments_offered, 0) + ?"
+					"     , out_payments_fulfilled = COALESCE(out_payments_fulfilled, 0) + ?"
+					"     , out_msatoshi_offered = COALESCE(out_msatoshi_offered, 0) + ?"
+					"     , out_msatoshi_fulfilled = COALESCE(out_msatoshi_fulfilled, 0) + ?"
+					" WHERE id = ?;"));
+	db_bind_u64(stmt, stats->in_payments_offered);
+	db_bind_u64(stmt, stats->in_payments_fulfilled);
+	db_bind_amount_msat(stmt, &stats->in_msatoshi_offered);
+	db_bind_amount_msat(stmt, &stats->in_msatoshi_fulfilled);
+	db_bind_u64(stmt, stats->out_payments_offered);
+	db_bind_u64(stmt, stats->out_payments_fulfilled);
+	db_bind_amount_msat(stmt, &stats->out_msatoshi_offered);
+	db_bind_amount_msat(stmt, &stats->out_msatoshi_fulfilled);
+	db_bind_u64(stmt, chan->dbid);
+	db_exec_prepared_v2(take(stmt));
+
+	memset(&chan->stats_unflushed, 0, sizeof(chan->stats_unflushed));
 }
 
 void wallet_blocks_heights(struct wallet *w, u32 def, u32 *min, u32 *max)
@@ -2397,6 +2523,9 @@ void wallet_channel_save(struct wallet *w, struct channel *chan)
 	db_bind_u64(stmt, chan->dbid);
 	db_exec_prepared_v2(take(stmt));
 
+	/* This is a good time to write out any HTLC statistics, too. */
+	wallet_channel_stats_flush(w, chan);
+
 	wallet_channel_config_save(w, &chan->channel_info.their_config);
 	stmt = db_prepare_v2(w->db, SQL("UPDATE channels SET"
 					"  fundingkey_remote=?,"
@@ -2484,6 +2613,7 @@ void wallet_channel_save(struct wallet *w, struct channel *chan)
 	db_bind_u64(stmt, chan->dbid);
 	db_exec_prepared_v2(take(stmt));
 
+	channel_index_updated_if_changed(chan);
 	channel_gossip_update(chan);
 }
 
@@ -2516,39 +2646,6 @@ void wallet_state_change_add(struct wallet *w,
 	db_exec_prepared_v2(take(stmt));
 }
 
-struct state_change_entry *wallet_state_change_get(const tal_t *ctx,
-						   struct wallet *w,
-						   u64 channel_id)
-{
-	struct db_stmt *stmt;
-	struct state_change_entry tmp;
-	struct state_change_entry *res = tal_arr(ctx,
-						 struct state_change_entry, 0);
-	stmt = db_prepare_v2(
-	    w->db, SQL("SELECT"
-		       " timestamp,"
-		       " old_state,"
-		       " new_state,"
-		       " cause,"
-		       " message "
-		       "FROM channel_state_changes "
-		       "WHERE channel_id = ? "
-		       "ORDER BY timestamp ASC;"));
-	db_bind_int(stmt, channel_id);
-	db_query_prepared(stmt);
-
-	while (db_step(stmt)) {
-		tmp.timestamp = db_col_timeabs(stmt, "timestamp");
-		tmp.old_state = db_col_int(stmt, "old_state");
-		tmp.new_state = db_col_int(stmt, "new_state");
-		tmp.cause = state_change_in_db(db_col_int(stmt, "cause"));
-		tmp.message = db_col_strdup(res, stmt, "message");
-		tal_arr_expand(&res, tmp);
-	}
-	tal_free(stmt);
-	return res;
-}
-
 static void wallet_peer_save(struct wallet *w, struct peer *peer)
 {
 	const char *addr =
@@ -2629,7 +2726,8 @@ void wallet_channel_insert(struct wallet *w, struct channel *chan)
 		       ", funding_pubkey_local"
 		       ", require_confirm_inputs_remote"
 		       ", require_confirm_inputs_local"
-		       ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"));
+		       ", created_index"
+		       ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"));
 	db_bind_u64(stmt, chan->peer->dbid);
 	db_bind_int(stmt, chan->first_blocknum);
 	db_bind_int(stmt, chan->dbid);
@@ -2641,6 +2739,8 @@ void wallet_channel_insert(struct wallet *w, struct channel *chan)
 	db_bind_pubkey(stmt, &chan->local_funding_pubkey);
 	db_bind_int(stmt, chan->req_confirmed_ins[REMOTE]);
 	db_bind_int(stmt, chan->req_confirmed_ins[LOCAL]);
+	channel_index_created(chan);
+	db_bind_u64(stmt, chan->created_index);
 
 	db_exec_prepared_v2(take(stmt));
 
@@ -3186,17 +3286,20 @@ static void fixup_hin(struct wallet *wallet, struct htlc_in *hin)
 #endif
 }
 
-bool wallet_htlcs_load_in_for_channel(struct wallet *wallet,
-				      struct channel *chan,
-				      struct htlc_in_map *htlcs_in)
+bool wallet_htlcs_load_in(struct wallet *wallet,
+			  struct channel **chans,
+			  struct htlc_in_map *htlcs_in)
 {
 	struct db_stmt *stmt;
 	bool ok = true;
 	int incount = 0;
+	struct channel **sorted = channels_sorted_by_dbid(tmpctx, chans);
 
-	log_debug(wallet->log, "Loading in HTLCs for channel %"PRIu64, chan->dbid);
+	log_debug(wallet->log, "Loading in HTLCs for %zu channels",
+		  tal_count(chans));
 	stmt = db_prepare_v2(wallet->db, SQL("SELECT"
 					     "  id"
+					     ", channel_id"
 					     ", channel_htlc_id"
 					     ", msatoshi"
 					     ", cltv_expiry"
@@ -3212,10 +3315,10 @@ bool wallet_htlcs_load_in_for_channel(struct wallet *wallet,
 					     ", fail_immediate"
 					     " FROM channel_htlcs"
 					     " WHERE direction= ?"
-					     " AND channel_id= ?"
-					     " AND hstate NOT IN (?, ?)"));
+					     " AND hstate NOT IN (?, ?)"
+					     " AND channel_id IN"
+					     "  (SELECT id FROM channels WHERE state != ?)"));
 	db_bind_int(stmt, DIRECTION_INCOMING);
-	db_bind_u64(stmt, chan->dbid);
 	/* We need to generate `hstate NOT IN (9, 19)` in order to match
 	 * the `WHERE` clause of the database index; incoming HTLCs will
 	 * never actually get the state `RCVD_REMOVE_ACK_REVOCATION`.
@@ -3223,10 +3326,18 @@ bool wallet_htlcs_load_in_for_channel(struct wallet *wallet,
 	 */
 	db_bind_int(stmt, RCVD_REMOVE_ACK_REVOCATION); /* Not gonna happen.  */
 	db_bind_int(stmt, SENT_REMOVE_ACK_REVOCATION);
+	/* Closed channels aren't loaded, so neither are their HTLCs */
+	db_bind_int(stmt, CLOSED);
 	db_query_prepared(stmt);
 
 	while (db_step(stmt)) {
-		struct htlc_in *in = tal(chan, struct htlc_in);
+		struct htlc_in *in;
+		struct channel *chan;
+
+		chan = channel_in_sorted(wallet, sorted,
+					 db_col_u64(stmt, "channel_id"));
+
+		in = tal(chan, struct htlc_in);
 		ok &= wallet_stmt2htlc_in(chan, stmt, in);
 		connect_htlc_in(htlcs_in, in);
 		fixup_hin(wallet, in);
@@ -3239,17 +3350,19 @@ bool wallet_htlcs_load_in_for_channel(struct wallet *wallet,
 	return ok;
 }
 
-bool wallet_htlcs_load_out_for_channel(struct wallet *wallet,
-				       struct channel *chan,
-				       struct htlc_out_map *htlcs_out,
-				       struct htlc_in_map *unconnected_htlcs_in)
+bool wallet_htlcs_load_out(struct wallet *wallet,
+			   struct channel **chans,
+			   struct htlc_out_map *htlcs_out,
+			   struct htlc_in_map *unconnected_htlcs_in)
 {
 	struct db_stmt *stmt;
 	bool ok = true;
 	int outcount = 0;
+	struct channel **sorted = channels_sorted_by_dbid(tmpctx, chans);
 
 	stmt = db_prepare_v2(wallet->db, SQL("SELECT"
 					     "  id"
+					     ", channel_id"
 					     ", channel_htlc_id"
 					     ", msatoshi"
 					     ", cltv_expiry"
@@ -3265,10 +3378,10 @@ bool wallet_htlcs_load_out_for_channel(struct wallet *wallet,
 					     ", fees_msat"
 					     " FROM channel_htlcs"
 					     " WHERE direction = ?"
-					     " AND channel_id = ?"
-					     " AND hstate NOT IN (?, ?)"));
+					     " AND hstate NOT IN (?, ?)"
+					     " AND channel_id IN"
+					     "  (SELECT id FROM channels WHERE state != ?)"));
 	db_bind_int(stmt, DIRECTION_OUTGOING);
-	db_bind_u64(stmt, chan->dbid);
 	/* We need to generate `hstate NOT IN (9, 19)` in order to match
 	 * the `WHERE` clause of the database index; outgoing HTLCs will
 	 * never actually get the state `SENT_REMOVE_ACK_REVOCATION`.
@@ -3276,10 +3389,17 @@ bool wallet_htlcs_load_out_for_channel(struct wallet *wallet,
 	 */
 	db_bind_int(stmt, RCVD_REMOVE_ACK_REVOCATION);
 	db_bind_int(stmt, SENT_REMOVE_ACK_REVOCATION); /* Not gonna happen.  */
+	db_bind_int(stmt, CLOSED);
 	db_query_prepared(stmt);
 
 	while (db_step(stmt)) {
-		struct htlc_out *out = tal(chan, struct htlc_out);
+		struct htlc_out *out;
+		struct channel *chan;
+
+		chan = channel_in_sorted(wallet, sorted,
+					 db_col_u64(stmt, "channel_id"));
+
+		out = tal(chan, struct htlc_out);
 		ok &= wallet_stmt2htlc_out(wallet, chan, stmt, out,
 					   unconnected_htlcs_in);
 		connect_htlc_out(htlcs_out, out);
@@ -3564,6 +3684,65 @@ void wallet_payment_delete(struct wallet *wallet,
 	db_exec_prepared_v2(take(stmt));
 }
 
+u32 wallet_payments_delete_older(struct wallet *wallet,
+				 enum payment_status status,
+				 u64 created_before,
+				 u32 max)
+{
+	struct db_stmt *stmt;
+	struct old_payment {
+		u64 id, partid, groupid;
+		struct sha256 payment_hash;
+	} *pays = tal_arr(tmpctx, struct old_payment, 0);
+
+	stmt = db_prepare_v2(wallet->db,
+			     SQL("SELECT"
+				 "  id"
+				 ", payment_hash"
+				 ", partid"
+				 ", groupid"
+				 " FROM payments"
+				 " WHERE status = ?"
+				 "   AND timestamp <= ?"
+				 " ORDER BY id"
+				 " LIMIT ?;"));
+	db_bind_int(stmt, status);
+	db_bind_u64(stmt, created_before);
+	db_bind_int(stmt, max);
+	db_query_prepared(stmt);
+
+	while (db_step(stmt)) {
+		struct old_payment p;
+
+		p.id = db_col_u64(stmt, "id");
+		db_col_sha256(stmt, "payment_hash", &p.payment_hash);
+		p.partid = db_col_u64(stmt, "partid");
+		p.groupid = db_col_u64(stmt, "groupid");
+		tal_arr_expand(&pays, p);
+	}
+	tal_free(stmt);
+
+	if (tal_count(pays) == 0)
+		return 0;
+
+	/* They're the oldest, so this deletes exactly those. */
+	stmt = db_prepare_v2(wallet->db,
+			     SQL("DELETE FROM payments"
+				 " WHERE status = ?"
+				 "   AND timestamp <= ?"
+				 "   AND id <= ?;"));
+	db_bind_int(stmt, status);
+	db_bind_u64(stmt, created_before);
+	db_bind_u64(stmt, pays[tal_count(pays) - 1].id);
+	db_exec_prepared_v2(take(stmt));
+
+	for (size_t i = 0; i < tal_count(pays); i++)
+		sendpay_index_deleted(wallet->ld, &pays[i].payment_hash,
+				      pays[i].partid, pays[i].groupid, status);
+
+	return tal_count(pays);
+}
+
 static
 struct wallet_payment *wallet_payment_new(const tal_t *ctx,
 					  u64 dbid,
@@ -4980,7 +5159,7 @@ notify:
 struct amount_msat wallet_total_forward_fees(struct wallet *w)
 {
 	struct db_stmt *stmt;
-	struct amount_msat total, deleted;
+	struct amount_msat total, deleted, archived;
 	bool res;
 
 	stmt = db_prepare_v2(w->db, SQL("SELECT"
@@ -5002,58 +5181,37 @@ struct amount_msat wallet_total_forward_fees(struct wallet *w)
 			 fmt_amount_msat(tmpctx, total),
 			 fmt_amount_msat(tmpctx, deleted));
 
+	archived = amount_msat(db_get_intvar(w->db, "archived_forward_fees", 0));
+	if (!amount_msat_add(&total, total, archived))
+		db_fatal(w->db, "Adding forward fees %s + %s overflowed",
+			 fmt_amount_msat(tmpctx, total),
+			 fmt_amount_msat(tmpctx, archived));
+
 	return total;
 }
 
-const struct forwarding *wallet_forwarded_payments_get(const tal_t *ctx,
-						       struct wallet *w,
-						       enum forward_status status,
-						       const struct short_channel_id *chan_in,
-						       const struct short_channel_id *chan_out,
-						       const enum wait_index *listindex,
-						       u64 liststart,
-						       const u32 *listlimit)
+/* Binds the parameters common to all the forwards listing queries. */
+static void bind_forwards_query(struct db_stmt *stmt,
+				enum forward_status status,
+				const struct short_channel_id *chan_in,
+				const struct short_channel_id *chan_out,
+				u64 liststart,
+				const u32 *listlimit)
 {
-	struct forwarding *results = tal_arr(ctx, struct forwarding, 0);
-	size_t count = 0;
-	struct db_stmt *stmt;
-
 	// placeholder for any parameter, the value doesn't matter because it's discarded by sql
 	const int any = -1;
 
-	/* We don't support start/limits with this */
-	if (chan_in || chan_out) {
-		stmt = db_prepare_v2(
-			w->db,
-			SQL("SELECT"
-			    "  state"
-			    ", in_msatoshi"
-			    ", out_msatoshi"
-			    ", in_channel_scid"
-			    ", out_channel_scid"
-			    ", in_htlc_id"
-			    ", out_htlc_id"
-			    ", received_time"
-			    ", resolved_time"
-			    ", failcode "
-			    ", forward_style "
-			    ", rowid "
-			    ", updated_index "
-			    "FROM forwards "
-			    "WHERE (1 = ? OR state = ?) AND "
-			    "(1 = ? OR in_channel_scid = ?) AND "
-			    "(1 = ? OR out_channel_scid = ?)"));
-
-		if (status == FORWARD_ANY) {
-			// any status
-			db_bind_int(stmt, 1);
-			db_bind_int(stmt, any);
-		} else {
-			// specific forward status
-			db_bind_int(stmt, 0);
-			db_bind_int(stmt, status);
-		}
+	if (status == FORWARD_ANY) {
+		// any status
+		db_bind_int(stmt, 1);
+		db_bind_int(stmt, any);
+	} else {
+		// specific forward status
+		db_bind_int(stmt, 0);
+		db_bind_int(stmt, status);
+	}
 
+	if (chan_in || chan_out) {
 		if (chan_in) {
 			// specific in_channel
 			db_bind_int(stmt, 0);
@@ -5073,83 +5231,24 @@ const struct forwarding *wallet_forwarded_payments_get(const tal_t *ctx,
 			db_bind_int(stmt, 1);
 			db_bind_int(stmt, any);
 		}
-	} else if (listindex && *listindex == WAIT_INDEX_UPDATED) {
-		stmt = db_prepare_v2(
-			w->db,
-			SQL("SELECT"
-			    "  state"
-			    ", in_msatoshi"
-			    ", out_msatoshi"
-			    ", in_channel_scid"
-			    ", out_channel_scid"
-			    ", in_htlc_id"
-			    ", out_htlc_id"
-			    ", received_time"
-			    ", resolved_time"
-			    ", failcode "
-			    ", forward_style "
-			    ", rowid "
-			    ", updated_index "
-			    "FROM forwards "
-			    " WHERE"
-			    "  (1 = ? OR state = ?)"
-			    " AND"
-			    "  updated_index >= ?"
-			    " ORDER BY updated_index"
-			    " LIMIT ?;"));
-		if (status == FORWARD_ANY) {
-			// any status
-			db_bind_int(stmt, 1);
-			db_bind_int(stmt, any);
-		} else {
-			// specific forward status
-			db_bind_int(stmt, 0);
-			db_bind_int(stmt, status);
-		}
-		db_bind_u64(stmt, liststart);
-		if (listlimit)
-			db_bind_int(stmt, *listlimit);
-		else
-			db_bind_int(stmt, INT_MAX);
-	} else {
-		stmt = db_prepare_v2(
-			w->db,
-			SQL("SELECT"
-			    "  state"
-			    ", in_msatoshi"
-			    ", out_msatoshi"
-			    ", in_channel_scid"
-			    ", out_channel_scid"
-			    ", in_htlc_id"
-			    ", out_htlc_id"
-			    ", received_time"
-			    ", resolved_time"
-			    ", failcode "
-			    ", forward_style "
-			    ", rowid "
-			    ", updated_index "
-			    "FROM forwards "
-			    " WHERE"
-			    "  (1 = ? OR state = ?)"
-			    " AND"
-			    "  rowid >= ?"
-			    " ORDER BY rowid"
-			    " LIMIT ?;"));
-		if (status == FORWARD_ANY) {
-			// any status
-			db_bind_int(stmt, 1);
-			db_bind_int(stmt, any);
-		} else {
-			// specific forward status
-			db_bind_int(stmt, 0);
-			db_bind_int(stmt, status);
-		}
-		db_bind_u64(stmt, liststart);
-		if (listlimit)
-			db_bind_int(stmt, *listlimit);
-		else
-			db_bind_int(stmt, INT_MAX);
 	}
+
+	db_bind_u64(stmt, liststart);
+	if (listlimit)
+		db_bind_int(stmt, *listlimit);
+	else
+		db_bind_int(stmt, INT_MAX);
+}
+
+/* created_col is "rowid" for forwards, "created_index" for the archive */
+static struct forwarding *forwards_from_stmt(const tal_t *ctx,
+					     struct wallet *w,
+					     struct db_stmt *stmt,
+					     const char *created_col)
+{
+	struct forwarding *results = tal_arr(ctx, struct forwarding, 0);
+	size_t count;
+
 	db_query_prepared(stmt);
 
 	for (count=0; db_step(stmt); count++) {
@@ -5157,7 +5256,7 @@ const struct forwarding *wallet_forwarded_payments_get(const tal_t *ctx,
 		struct forwarding *cur = &results[count];
 		cur->status = db_col_int(stmt, "state");
 		cur->msat_in = db_col_amount_msat(stmt, "in_msatoshi");
-		cur->created_index = db_col_u64(stmt, "rowid");
+		cur->created_index = db_col_u64(stmt, created_col);
 		cur->updated_index = db_col_u64(stmt, "updated_index");
 
 		if (!db_col_is_null(stmt, "out_msatoshi")) {
@@ -5196,7 +5295,7 @@ const struct forwarding *wallet_forwarded_payments_get(const tal_t *ctx,
 			cur->channel_out.u64 = 0;
 		}
 		if (!db_col_is_null(stmt, "out_htlc_id")) {
-			cur->htlc_id_out = tal(results, u64);
+			cur->htlc_id_out = tal(ctx, u64);
 			*cur->htlc_id_out = db_col_u64(stmt, "out_htlc_id");
 		} else
 			cur->htlc_id_out = NULL;
@@ -5229,6 +5328,221 @@ const struct forwarding *wallet_forwarded_payments_get(const tal_t *ctx,
 	return results;
 }
 
+static u64 forwarding_key(const struct forwarding *f, bool by_updated)
+{
+	return by_updated ? f->updated_index : f->created_index;
+}
+
+/* Both are sorted: merge them, up to listlimit. */
+static struct forwarding *merge_forwards(const tal_t *ctx,
+					 const struct forwarding *a,
+					 const struct forwarding *b,
+					 bool by_updated,
+					 const u32 *listlimit)
+{
+	struct forwarding *results = tal_arr(ctx, struct forwarding, 0);
+	size_t ia = 0, ib = 0;
+
+	while (ia < tal_count(a) || ib < tal_count(b)) {
+		if (listlimit && tal_count(results) == *listlimit)
+			break;
+		if (ib == tal_count(b)
+		    || (ia < tal_count(a)
+			&& forwarding_key(&a[ia], by_updated)
+			<= forwarding_key(&b[ib], by_updated)))
+			tal_arr_expand(&results, a[ia++]);
+		else
+			tal_arr_expand(&results, b[ib++]);
+	}
+	return results;
+}
+
+const struct forwarding *wallet_forwarded_payments_get(const tal_t *ctx,
+						       struct wallet *w,
+						       enum forward_status status,
+						       const struct short_channel_id *chan_in,
+						       const struct short_channel_id *chan_out,
+						       const enum wait_index *listindex,
+						       u64 liststart,
+						       const u32 *listlimit)
+{
+	struct db_stmt *stmt, *archive_stmt;
+	struct forwarding *results, *archived, *merged;
+	bool by_updated = false;
+
+	/* The API doesn't allow start with these, but we page by rowid
+	 * internally. */
+	if (chan_in || chan_out) {
+		stmt = db_prepare_v2(
+			w->db,
+			SQL("SELECT"
+			    "  state"
+			    ", in_msatoshi"
+			    ", out_msatoshi"
+			    ", in_channel_scid"
+			    ", out_channel_scid"
+			    ", in_htlc_id"
+			    ", out_htlc_id"
+			    ", received_time"
+			    ", resolved_time"
+			    ", failcode "
+			    ", forward_style "
+			    ", rowid "
+			    ", updated_index "
+			    "FROM forwards "
+			    "WHERE (1 = ? OR state = ?) AND "
+			    "(1 = ? OR in_channel_scid = ?) AND "
+			    "(1 = ? OR out_channel_scid = ?) AND "
+			    "rowid >= ?"
+			    " ORDER BY rowid"
+			    " LIMIT ?;"));
+		archive_stmt = db_prepare_v2(
+			w->db,
+			SQL("SELECT"
+			    "  state"
+			    ", in_msatoshi"
+			    ", out_msatoshi"
+			    ", in_channel_scid"
+			    ", out_channel_scid"
+			    ", in_htlc_id"
+			    ", out_htlc_id"
+			    ", received_time"
+			    ", resolved_time"
+			    ", failcode "
+			    ", forward_style "
+			    ", created_index "
+			    ", updated_index "
+			    "FROM forwards_archive "
+			    "WHERE (1 = ? OR state = ?) AND "
+			    "(1 = ? OR in_channel_scid = ?) AND "
+			    "(1 = ? OR out_channel_scid = ?) AND "
+			    "created_index >= ?"
+			    " ORDER BY created_index"
+			    " LIMIT ?;"));
+	} else if (listindex && *listindex == WAIT_INDEX_UPDATED) {
+		by_updated = true;
+		stmt = db_prepare_v2(
+			w->db,
+			SQL("SELECT"
+			    "  state"
+			    ", in_msatoshi"
+			    ", out_msatoshi"
+			    ", in_channel_scid"
+			    ", out_channel_scid"
+			    ", in_htlc_id"
+			    ", out_htlc_id"
+			    ", received_time"
+			    ", resolved_time"
+			    ", failcode "
+			    ", forward_style "
+			    ", rowid "
+			    ", updated_index "
+			    "FROM forwards "
+			    " WHERE"
+			    "  (1 = ? OR state = ?)"
+			    " AND"
+			    "  updated_index >= ?"
+			    " ORDER BY updated_index"
+			    " LIMIT ?;"));
+		archive_stmt = db_prepare_v2(
+			w->db,
+			SQL("SELECT"
+			    "  state"
+			    ", in_msatoshi"
+			    ", out_msatoshi"
+			    ", in_channel_scid"
+			    ", out_channel_scid"
+			    ", in_htlc_id"
+			    ", out_htlc_id"
+			    ", received_time"
+			    ", resolved_time"
+			    ", failcode "
+			    ", forward_style "
+			    ", created_index "
+			    ", updated_index "
+			    "FROM forwards_archive "
+			    " WHERE"
+			    "  (1 = ? OR state = ?)"
+			    " AND"
+			    "  updated_index >= ?"
+			    " ORDER BY updated_index"
+			    " LIMIT ?;"));
+	} else {
+		stmt = db_prepare_v2(
+			w->db,
+			SQL("SELECT"
+			    "  state"
+			    ", in_msatoshi"
+			    ", out_msatoshi"
+			    ", in_channel_scid"
+			    ", out_channel_scid"
+			    ", in_htlc_id"
+			    ", out_htlc_id"
+			    ", received_time"
+			    ", resolved_time"
+			    ", failcode "
+			    ", forward_style "
+			    ", rowid "
+			    ", updated_index "
+			    "FROM forwards "
+			    " WHERE"
+			    "  (1 = ? OR state = ?)"
+			    " AND"
+			    "  rowid >= ?"
+			    " ORDER BY rowid"
+			    " LIMIT ?;"));
+		archive_stmt = db_prepare_v2(
+			w->db,
+			SQL("SELECT"
+			    "  state"
+			    ", in_msatoshi"
+			    ", out_msatoshi"
+			    ", in_channel_scid"
+			    ", out_channel_scid"
+			    ", in_htlc_id"
+			    ", out_htlc_id"
+			    ", received_time"
+			    ", resolved_time"
+			    ", failcode "
+			    ", forward_style "
+			    ", created_index "
+			    ", updated_index "
+			    "FROM forwards_archive "
+			    " WHERE"
+			    "  (1 = ? OR state = ?)"
+			    " AND"
+			    "  created_index >= ?"
+			    " ORDER BY created_index"
+			    " LIMIT ?;"));
+	}
+
+	bind_forwards_query(stmt, status, chan_in, chan_out,
+			    liststart, listlimit);
+	bind_forwards_query(archive_stmt, status, chan_in, chan_out,
+			    liststart, listlimit);
+
+	/* Archived rows are interleaved with live ones (by either index), so
+	 * take the first listlimit of each, and merge. */
+	results = forwards_from_stmt(ctx, w, stmt, "rowid");
+	archived = forwards_from_stmt(ctx, w, archive_stmt, "created_index");
+	merged = merge_forwards(ctx, results, archived, by_updated, listlimit);
+	tal_free(results);
+	tal_free(archived);
+	return merged;
+}
+
+/* Add @fees to the running total in intvar @name */
+static void forward_fees_add(struct wallet *w, const char *name,
+			     struct amount_msat fees)
+{
+	if (amount_msat_eq(fees, AMOUNT_MSAT(0)))
+		return;
+
+	fees.millisatoshis += /* Raw: db access */
+		db_get_intvar(w->db, name, 0);
+	db_set_intvar(w->db, name, fees.millisatoshis); /* Raw: db access */
+}
+
 bool wallet_forward_delete(struct wallet *w,
 			   struct short_channel_id chan_in,
 			   const u64 *htlc_id,
@@ -5266,10 +5580,7 @@ bool wallet_forward_delete(struct wallet *w,
 			struct amount_msat deleted;
 
 			deleted = db_col_amount_msat(stmt, "CAST(COALESCE(SUM(in_msatoshi - out_msatoshi), 0) AS BIGINT)");
-			deleted.millisatoshis += /* Raw: db access */
-				db_get_intvar(w->db, "deleted_forward_fees", 0);
-			db_set_intvar(w->db, "deleted_forward_fees",
-				      deleted.millisatoshis); /* Raw: db access */
+			forward_fees_add(w, "deleted_forward_fees", deleted);
 		}
 		tal_free(stmt);
 	}
@@ -5296,6 +5607,32 @@ bool wallet_forward_delete(struct wallet *w,
 	changed = db_count_changes(stmt) != 0;
 	tal_free(stmt);
 
+	/* Not live?  Maybe it's been archived.  Its fees are already counted
+	 * in archived_forward_fees, so nothing to add to deleted ones. */
+	if (!changed) {
+		if (htlc_id) {
+			stmt = db_prepare_v2(w->db,
+					     SQL("DELETE FROM forwards_archive"
+						 " WHERE in_channel_scid = ?"
+						 " AND in_htlc_id = ?"
+						 " AND state = ?"));
+			db_bind_short_channel_id(stmt, chan_in);
+			db_bind_u64(stmt, *htlc_id);
+			db_bind_int(stmt, wallet_forward_status_in_db(state));
+		} else {
+			stmt = db_prepare_v2(w->db,
+					     SQL("DELETE FROM forwards_archive"
+						 " WHERE in_channel_scid = ?"
+						 " AND in_htlc_id IS NULL"
+						 " AND state = ?"));
+			db_bind_short_channel_id(stmt, chan_in);
+			db_bind_int(stmt, wallet_forward_status_in_db(state));
+		}
+		db_exec_prepared_v2(stmt);
+		changed = db_count_changes(stmt) != 0;
+		tal_free(stmt);
+	}
+
 	if (changed) {
 		/* FIXME: We don't set in->msat or out here, since that would
 		 * need an extra lookup */
@@ -5309,6 +5646,243 @@ bool wallet_forward_delete(struct wallet *w,
 	return changed;
 }
 
+u32 wallet_forwards_archive(struct wallet *w, struct timeabs resolved_before,
+			    u32 max)
+{
+	struct db_stmt *stmt;
+	u64 *rowids = tal_arr(tmpctx, u64, 0);
+	struct amount_msat fees = AMOUNT_MSAT(0);
+
+	stmt = db_prepare_v2(w->db, SQL("SELECT"
+					"  rowid"
+					", state"
+					", in_msatoshi"
+					", out_msatoshi"
+					" FROM forwards"
+					" WHERE resolved_time < ?"
+					" ORDER BY rowid"
+					" LIMIT ?;"));
+	db_bind_timeabs(stmt, resolved_before);
+	db_bind_int(stmt, max);
+	db_query_prepared(stmt);
+
+	while (db_step(stmt)) {
+		enum forward_status state;
+
+		tal_arr_expand(&rowids, db_col_u64(stmt, "rowid"));
+		state = wallet_forward_status_in_db(db_col_int(stmt, "state"));
+		if (state == FORWARD_SETTLED) {
+			struct amount_msat in, out, fee;
+
+			in = db_col_amount_msat(stmt, "in_msatoshi");
+			out = db_col_amount_msat(stmt, "out_msatoshi");
+			if (amount_msat_sub(&fee, in, out)
+			    && !amount_msat_add(&fees, fees, fee))
+				db_fatal(w->db, "Archived forward fees overflowed");
+		} else {
+			db_col_ignore(stmt, "in_msatoshi");
+			db_col_ignore(stmt, "out_msatoshi");
+		}
+	}
+	tal_free(stmt);
+
+	for (size_t i = 0; i < tal_count(rowids); i++) {
+		stmt = db_prepare_v2(w->db, SQL("INSERT INTO forwards_archive ("
+						"  created_index"
+						", in_channel_scid"
+						", in_htlc_id"
+						", out_channel_scid"
+						", out_htlc_id"
+						", in_msatoshi"
+						", out_msatoshi"
+						", state"
+						", received_time"
+						", resolved_time"
+						", failcode"
+						", forward_style"
+						", updated_index"
+						") SELECT"
+						"  rowid"
+						", in_channel_scid"
+						", in_htlc_id"
+						", out_channel_scid"
+						", out_htlc_id"
+						", in_msatoshi"
+						", out_msatoshi"
+						", state"
+						", received_time"
+						", resolved_time"
+						", failcode"
+						", forward_style"
+						", updated_index"
+						" FROM forwards WHERE rowid = ?;"));
+		db_bind_u64(stmt, rowids[i]);
+		db_exec_prepared_v2(take(stmt));
+
+		stmt = db_prepare_v2(w->db, SQL("DELETE FROM forwards"
+						" WHERE rowid = ?;"));
+		db_bind_u64(stmt, rowids[i]);
+		db_exec_prepared_v2(take(stmt));
+	}
+
+	forward_fees_add(w, "archived_forward_fees", fees);
+	return tal_count(rowids);
+}
+
+/* Deletes the forwards @stmt selects (and frees it), oldest @keycol
+ * first.  It must return @keycol, in_channel_scid, in_htlc_id, in_msatoshi
+ * and out_msatoshi.  @del takes the same conditions, and an upper bound
+ * on @keycol, so it deletes exactly those. */
+static u32 forwards_delete_selected(struct wallet *w,
+				    struct db_stmt *stmt,
+				    struct db_stmt *del,
+				    const char *keycol,
+				    enum forward_status state,
+				    bool archived)
+{
+	struct short_channel_id *scids = tal_arr(tmpctx, struct short_channel_id, 0);
+	u64 *htlc_ids = tal_arr(tmpctx, u64, 0);
+	struct amount_msat fees = AMOUNT_MSAT(0);
+	u64 last_key = 0;
+
+	db_query_prepared(stmt);
+	while (db_step(stmt)) {
+		last_key = db_col_u64(stmt, keycol);
+		tal_arr_expand(&scids,
+			       db_col_short_channel_id(stmt, "in_channel_scid"));
+		if (db_col_is_null(stmt, "in_htlc_id"))
+			tal_arr_expand(&htlc_ids, HTLC_INVALID_ID);
+		else
+			tal_arr_expand(&htlc_ids,
+				       db_col_u64(stmt, "in_htlc_id"));
+
+		/* Archived fees are already in archived_forward_fees */
+		if (state == FORWARD_SETTLED && !archived) {
+			struct amount_msat in, out, fee;
+
+			in = db_col_amount_msat(stmt, "in_msatoshi");
+			out = db_col_amount_msat(stmt, "out_msatoshi");
+			if (amount_msat_sub(&fee, in, out)
+			    && !amount_msat_add(&fees, fees, fee))
+				db_fatal(w->db, "Deleted forward fees overflowed");
+		} else {
+			db_col_ignore(stmt, "in_msatoshi");
+			db_col_ignore(stmt, "out_msatoshi");
+		}
+	}
+	tal_free(stmt);
+
+	if (tal_count(scids) == 0) {
+		tal_free(del);
+		return 0;
+	}
+
+	db_bind_u64(del, last_key);
+	db_exec_prepared_v2(take(del));
+
+	for (size_t i = 0; i < tal_count(scids); i++)
+		forward_index_deleted(w->ld, state, scids[i], htlc_ids[i],
+				      NULL, NULL);
+
+	forward_fees_add(w, "deleted_forward_fees", fees);
+	return tal_count(scids);
+}
+
+u32 wallet_forwards_delete_older(struct wallet *w,
+				 enum forward_status state,
+				 struct timeabs before,
+				 u32 max)
+{
+	struct db_stmt *stmt, *del;
+	u32 num;
+
+	/* Failed forwards may have no resolved_time, so like autoclean always
+	 * has, we age them by received_time. */
+	if (state == FORWARD_SETTLED) {
+		stmt = db_prepare_v2(w->db, SQL("SELECT"
+						"  rowid"
+						", in_channel_scid"
+						", in_htlc_id"
+						", in_msatoshi"
+						", out_msatoshi"
+						" FROM forwards"
+						" WHERE state = ?"
+						" AND resolved_time < ?"
+						" ORDER BY rowid"
+						" LIMIT ?;"));
+		del = db_prepare_v2(w->db, SQL("DELETE FROM forwards"
+					       " WHERE state = ?"
+					       " AND resolved_time < ?"
+					       " AND rowid <= ?;"));
+	} else {
+		stmt = db_prepare_v2(w->db, SQL("SELECT"
+						"  rowid"
+						", in_channel_scid"
+						", in_htlc_id"
+						", in_msatoshi"
+						", out_msatoshi"
+						" FROM forwards"
+						" WHERE state = ?"
+						" AND received_time < ?"
+						" ORDER BY rowid"
+						" LIMIT ?;"));
+		del = db_prepare_v2(w->db, SQL("DELETE FROM forwards"
+					       " WHERE state = ?"
+					       " AND received_time < ?"
+					       " AND rowid <= ?;"));
+	}
+	db_bind_int(stmt, wallet_forward_status_in_db(state));
+	db_bind_timeabs(stmt, before);
+	db_bind_int(stmt, max);
+	db_bind_int(del, wallet_forward_status_in_db(state));
+	db_bind_timeabs(del, before);
+	num = forwards_delete_selected(w, stmt, del, "rowid", state, false);
+	if (num == max)
+		return num;
+
+	/* Live ones are all gone: now try the archive. */
+	if (state == FORWARD_SETTLED) {
+		stmt = db_prepare_v2(w->db, SQL("SELECT"
+						"  created_index"
+						", in_channel_scid"
+						", in_htlc_id"
+						", in_msatoshi"
+						", out_msatoshi"
+						" FROM forwards_archive"
+						" WHERE state = ?"
+						" AND resolved_time < ?"
+						" ORDER BY created_index"
+						" LIMIT ?;"));
+		del = db_prepare_v2(w->db, SQL("DELETE FROM forwards_archive"
+					       " WHERE state = ?"
+					       " AND resolved_time < ?"
+					       " AND created_index <= ?;"));
+	} else {
+		stmt = db_prepare_v2(w->db, SQL("SELECT"
+						"  created_index"
+						", in_channel_scid"
+						", in_htlc_id"
+						", in_msatoshi"
+						", out_msatoshi"
+						" FROM forwards_archive"
+						" WHERE state = ?"
+						" AND received_time < ?"
+						" ORDER BY created_index"
+						" LIMIT ?;"));
+		del = db_prepare_v2(w->db, SQL("DELETE FROM forwards_archive"
+					       " WHERE state = ?"
+					       " AND received_time < ?"
+					       " AND created_index <= ?;"));
+	}
+	db_bind_int(stmt, wallet_forward_status_in_db(state));
+	db_bind_timeabs(stmt, before);
+	db_bind_int(stmt, max - num);
+	db_bind_int(del, wallet_forward_status_in_db(state));
+	db_bind_timeabs(del, before);
+	return num + forwards_delete_selected(w, stmt, del, "created_index",
+					      state, true);
+}
+
 struct wallet_transaction *wallet_transactions_get(const tal_t *ctx, struct wallet *w)
 {
 	struct db_stmt *stmt;
@@ -670,13 +670,6 @@ void wallet_state_change_add(struct wallet *w,
 			     enum state_change cause,
 			     const char *message);
 
-/**
- * Gets all state change history entries for a channel from the database
- */
-struct state_change_entry *wallet_state_change_get(const tal_t *ctx,
-						   struct wallet *w,
-						   u64 channel_id);
-
 /**
  * wallet_delete_peer_if_unused -- After no more channels in peer, forget about it
  */
@@ -707,22 +700,26 @@ struct closed_channel **wallet_load_closed_channels(const tal_t *ctx,
  * wallet_channel_stats_incr_* - Increase channel statistics.
  *
  * @w: wallet containing the channel
- * @cdbid: channel database id
+ * @chan: the channel
  * @msatoshi: amount in msatoshi being transferred
+ *
+ * These are only accumulated in @chan until wallet_channel_stats_flush().
  */
-void wallet_channel_stats_incr_in_offered(struct wallet *w, u64 cdbid, struct amount_msat msatoshi);
-void wallet_channel_stats_incr_in_fulfilled(struct wallet *w, u64 cdbid, struct amount_msat msatoshi);
-void wallet_channel_stats_incr_out_offered(struct wallet *w, u64 cdbid, struct amount_msat msatoshi);
-void wallet_channel_stats_incr_out_fulfilled(struct wallet *w, u64 cdbid, struct amount_msat msatoshi);
+void wallet_channel_stats_incr_in_offered(struct wallet *w, struct channel *chan, struct amount_msat msatoshi);
+void wallet_channel_stats_incr_in_fulfilled(struct wallet *w, struct channel *chan, struct amount_msat msatoshi);
+void wallet_channel_stats_incr_out_offered(struct wallet *w, struct channel *chan, struct amount_msat msatoshi);
+void wallet_channel_stats_incr_out_fulfilled(struct wallet *w, struct channel *chan, struct amount_msat msatoshi);
 
 /**
- * wallet_channel_stats_load - Load channel statistics
+ * wallet_channel_stats_flush - Write out accumulated channel statistics
  *
  * @w: wallet containing the channel
- * @cdbid: channel database id
- * @stats: location to load statistics to
+ * @chan: the channel
+ *
+ * Called by wallet_channel_save(), and on a timer after the first
+ * increment.
  */
-void wallet_channel_stats_load(struct wallet *w, u64 cdbid, struct channel_stats *stats);
+void wallet_channel_stats_flush(struct wallet *w, struct channel *chan);
 
 /**
  * Retrieve the blockheight of the last block processed by lightningd.
@@ -800,24 +797,24 @@ void wallet_htlc_update(struct wallet *wallet, const u64 htlc_dbid,
 			bool *we_filled);
 
 /**
- * wallet_htlcs_load_in_for_channel - Load incoming HTLCs associated with chan from DB.
+ * wallet_htlcs_load_in - Load incoming HTLCs for all these channels from DB.
  *
  * @wallet: wallet to load from
- * @chan: load HTLCs associated with this channel
+ * @chans: every channel which isn't closed
  * @htlcs_in: htlc_in_map to store loaded htlc_in in
  *
- * This function looks for incoming HTLCs that are associated with the given
- * channel and loads them into the provided map.
+ * This loads the incoming HTLCs of all the channels in a single query, and
+ * attaches each to its channel.
  */
-bool wallet_htlcs_load_in_for_channel(struct wallet *wallet,
-				      struct channel *chan,
-				      struct htlc_in_map *htlcs_in);
+bool wallet_htlcs_load_in(struct wallet *wallet,
+			  struct channel **chans,
+			  struct htlc_in_map *htlcs_in);
 
 /**
- * wallet_htlcs_load_out_for_channel - Load outgoing HTLCs associated with chan from DB.
+ * wallet_htlcs_load_out - Load outgoing HTLCs for all these channels from DB.
  *
  * @wallet: wallet to load from
- * @chan: load HTLCs associated with this channel
+ * @chans: every channel which isn't closed
  * @htlcs_out: htlc_out_map to store loaded htlc_out in.
  * @remaining_htlcs_in: htlc_in_map with unconnected htlcs (removed as we progress)
  *
@@ -825,10 +822,10 @@ bool wallet_htlcs_load_in_for_channel(struct wallet *wallet,
  * possible that it's still NULL, since we can have outgoing HTLCs
  * outlive their corresponding incoming.
  */
-bool wallet_htlcs_load_out_for_channel(struct wallet *wallet,
-				       struct channel *chan,
-				       struct htlc_out_map *htlcs_out,
-				       struct htlc_in_map *remaining_htlcs_in);
+bool wallet_htlcs_load_out(struct wallet *wallet,
+			   struct channel **chans,
+			   struct htlc_out_map *htlcs_out,
+			   struct htlc_in_map *remaining_htlcs_in);
 
 /**
  * wallet_announcement_save - Save remote announcement information with channel.
@@ -927,6 +924,18 @@ void wallet_payment_delete(struct wallet *wallet,
 			   const u64 *groupid, const u64 *partid,
 			   const enum payment_status *status);
 
+/**
+ * wallet_payments_delete_older - Remove old payments in bulk
+ *
+ * Removes up to @max payments with @status created no later than
+ * @created_before (seconds since epoch), oldest first.  Returns the
+ * number removed.
+ */
+u32 wallet_payments_delete_older(struct wallet *wallet,
+				 enum payment_status status,
+				 u64 created_before,
+				 u32 max);
+
 /**
  * wallet_local_htlc_out_delete - Remove a local outgoing failed HTLC
  *
@@ -1274,6 +1283,28 @@ bool wallet_forward_delete(struct wallet *w,
 			   const u64 *htlc_id,
 			   enum forward_status state);
 
+/**
+ * Move up to @max forwards resolved before @resolved_before into the archive
+ *
+ * Archived forwards are still listed and counted in the forward fees, but
+ * no longer slow down the queries against the live forwards table.
+ * Returns the number of forwards moved.
+ */
+u32 wallet_forwards_archive(struct wallet *w, struct timeabs resolved_before,
+			    u32 max);
+
+/**
+ * Delete up to @max forwards in @state from before @before
+ *
+ * Settled forwards go by their resolved_time, failed ones by their
+ * received_time.  Archived forwards are deleted once the live ones are
+ * gone.  Returns the number of forwards deleted.
+ */
+u32 wallet_forwards_delete_older(struct wallet *w,
+				 enum forward_status state,
+				 struct timeabs before,
+				 u32 max);
+
 /**
  * Load remote_ann_node_sig and remote_ann_bitcoin_sig
  *
@@ -2,6 +2,7 @@
 #include <bitcoin/base58.h>
 #include <bitcoin/script.h>
 #include <ccan/array_size/array_size.h>
+#include <ccan/asort/asort.h>
 #include <ccan/cast/cast.h>
 #include <common/addr.h>
 #include <common/bech32.h>
@@ -11,6 +12,8 @@
 #include <common/key_derive.h>
 #include <common/psbt_keypath.h>
 #include <common/psbt_open.h>
+#include <common/timeout.h>
+#include <db/common.h>
 #include <db/exec.h>
 #include <errno.h>
 #include <hsmd/hsmd_wiregen.h>
@@ -549,26 +552,73 @@ static void json_transaction_details(struct json_stream *response,
 		json_object_end(response);
 }
 
+/* Like listinvoices, we go back to the event loop after each batch.  The
+ * transactions are ordered by (blockheight, txindex), which isn't unique
+ * (and NULL for unconfirmed ones), so we can't page through the db: we load
+ * them all, and only produce the (much more expensive) JSON in batches. */
+#define LISTTRANSACTIONS_BATCH 1000
+
+struct listtransactions_iter {
+	struct command *cmd;
+	struct json_stream *response;
+	const struct wallet_transaction *txs;
+	size_t next;
+};
+
+/* Returns false if that was the last batch. */
+static bool listtransactions_batch(struct listtransactions_iter *iter)
+{
+	size_t end = iter->next + LISTTRANSACTIONS_BATCH;
+
+	if (end > tal_count(iter->txs))
+		end = tal_count(iter->txs);
+
+	for (; iter->next < end; iter->next++)
+		json_transaction_details(iter->response,
+					 &iter->txs[iter->next]);
+
+	return iter->next < tal_count(iter->txs);
+}
+
+static struct command_result *
+listtransactions_done(struct listtransactions_iter *iter)
+{
+	json_array_end(iter->response);
+	return command_success(iter->cmd, iter->response);
+}
+
+static void listtransactions_next(struct listtransactions_iter *iter)
+{
+	if (listtransactions_batch(iter)) {
+		new_reltimer(iter->cmd->ld->timers, iter, time_from_msec(0),
+			     listtransactions_next, iter);
+		return;
+	}
+	was_pending(listtransactions_done(iter));
+}
+
 static struct command_result *json_listtransactions(struct command *cmd,
 						      const char *buffer,
 						      const jsmntok_t *obj UNNEEDED,
 						      const jsmntok_t *params)
 {
-	struct json_stream *response;
-	struct wallet_transaction *txs;
+	struct listtransactions_iter *iter;
 
 	if (!param(cmd, buffer, params, NULL))
 		return command_param_failed();
 
-	txs = wallet_transactions_get(cmd, cmd->ld->wallet);
-
-	response = json_stream_success(cmd);
-	json_array_start(response, "transactions");
-	for (size_t i = 0; i < tal_count(txs); i++)
-		json_transaction_details(response, &txs[i]);
-
-	json_array_end(response);
-	return command_success(cmd, response);
+	iter = tal(cmd, struct listtransactions_iter);
+	iter->cmd = cmd;
+	iter->txs = wallet_transactions_get(iter, cmd->ld->wallet);
+	iter->next = 0;
+
+	iter->response = json_stream_success(cmd);
+	json_array_start(iter->response, "transactions");
+	if (!listtransactions_batch(iter))
+		return listtransactions_done(iter);
+	new_reltimer(cmd->ld->timers, iter, time_from_msec(0),
+		     listtransactions_next, iter);
+	return command_still_pending(cmd);
 }
 
 static const struct json_command listtransactions_command = {
@@ -1005,3 +1055,105 @@ static const struct json_command sendpsbt_command = {
 };
 
 AUTODATA(json_command, &sendpsbt_command);
+
+static int cmp_query_total(const size_t *a, const size_t *b,
+			   struct db_query_stats *stats)
+{
+	if (time_greater(stats[*a].total, stats[*b].total))
+		return -1;
+	if (time_less(stats[*a].total, stats[*b].total))
+		return 1;
+	return 0;
+}
+
+static void json_add_db_profile(struct json_stream *response,
+				const struct db *db)
+{
+	const struct db_profile *profile = db->profile;
+	size_t *idx = tal_arr(tmpctx, size_t, 0);
+
+	json_object_start(response, "transactions");
+	json_add_u64(response, "count", profile->transactions);
+	json_add_u64(response, "total_usec", time_to_usec(profile->tx_total));
+	json_add_u64(response, "max_usec", time_to_usec(profile->tx_max));
+	json_add_u64(response, "commit_total_usec",
+		     time_to_usec(profile->commit_total));
+	json_add_u64(response, "commit_max_usec",
+		     time_to_usec(profile->commit_max));
+	json_object_end(response);
+
+	/* Most expensive first */
+	for (size_t i = 0; i < tal_count(profile->queries); i++) {
+		if (profile->queries[i].executions)
+			tal_arr_expand(&idx, i);
+	}
+	asort(idx, tal_count(idx), cmp_query_total, profile->queries);
+
+	json_array_start(response, "queries");
+	for (size_t i = 0; i < tal_count(idx); i++) {
+		const struct db_query_stats *stats = &profile->queries[idx[i]];
+
+		json_object_start(response, NULL);
+		json_add_string(response, "query",
+				db->queries->query_table[idx[i]].query);
+		json_add_u64(response, "executions", stats->executions);
+		json_add_u64(response, "rows", stats->rows);
+		json_add_u64(response, "bytes_bound", stats->bytes_bound);
+		json_add_u64(response, "total_usec", time_to_usec(stats->total));
+		json_add_u64(response, "max_usec", time_to_usec(stats->max));
+		json_object_end(response);
+	}
+	json_array_end(response);
+}
+
+static struct command_result *json_dbprofile(struct command *cmd,
+					     const char *buffer,
+					     const jsmntok_t *obj UNNEEDED,
+					     const jsmntok_t *params)
+{
+	struct json_stream *response;
+	struct db *db = cmd->ld->wallet->db;
+	size_t hits, misses;
+	bool *enable;
+	u32 *slow_msec;
+
+	if (!param(cmd, buffer, params,
+		   p_opt("enable", param_bool, &enable),
+		   p_opt("slow_msec", param_u32, &slow_msec),
+		   NULL))
+		return command_param_failed();
+
+	if (slow_msec && !(enable && *enable))
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "Can only specify {slow_msec} with {enable}=true");
+
+	if (command_check_only(cmd))
+		return command_check_done(cmd);
+
+	if (enable) {
+		struct timerel slow;
+
+		if (slow_msec)
+			slow = time_from_msec(*slow_msec);
+		db_profile_enable(db, *enable, slow_msec ? &slow : NULL);
+	}
+
+	response = json_stream_success(cmd);
+	json_add_bool(response, "enabled", db->profile != NULL);
+	db_stmt_cache_stats(db, &hits, &misses);
+	json_object_start(response, "statement_cache");
+	json_add_u64(response, "hits", hits);
+	json_add_u64(response, "misses", misses);
+	json_object_end(response);
+	if (db->profile)
+		json_add_db_profile(response, db);
+	return command_success(cmd, response);
+}
+
+static const struct json_command dbprofile_command = {
+	"dbprofile",
+	"utility",
+	json_dbprofile,
+	"Show per-query database statistics, optionally turning profiling on or off with {enable}",
+};
+AUTODATA(json_command, &dbprofile_command);